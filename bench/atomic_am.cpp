@@ -0,0 +1,143 @@
+/*
+ * UPC++ benchmark: AM-based atomics versus GASNet atomics
+ *
+ * Each rank issues compare_exchange operations against a location owned by
+ * a peer, comparing the 64-bit atomic_domain (GASNet AMOs) with the 16-byte
+ * (pointer, tag) domain served by AMs on the owning rank.
+ *
+ * Reported dimensions:
+ *
+ *   peer = {self|local|remote}: Where the target location lives relative to
+ *     the initiator. A single rank job only measures self.
+ *
+ *   width = {8|16}: Size of the atomic type in bytes. 8 uses GASNet AMOs,
+ *     16 uses the AM fallback.
+ *
+ *   kind = {lat|bw}:
+ *     lat: One operation in flight at a time.
+ *     bw: `window` operations in flight, tracked by a single promise.
+ *
+ * Reported measurements:
+ *
+ *   ops = compare_exchange operations completed per second by one rank.
+ *
+ * Environment variables:
+ *
+ *   window (integer, default=64): Operations in flight for kind=bw.
+ *
+ *   wait_secs (decimal, default=0.5): Number of seconds per measurement.
+ */
+
+#include <upcxx/upcxx.hpp>
+
+#include "common/operator_new.hpp"
+#include "common/os_env.hpp"
+#include "common/report.hpp"
+#include "common/timer.hpp"
+
+#include <cstdint>
+#include <iostream>
+
+using upcxx::atomic_op;
+using upcxx::global_ptr;
+using upcxx::intrank_t;
+
+using namespace std;
+using namespace bench;
+
+struct tagged_ptr {
+  uintptr_t ptr;
+  uint64_t tag;
+};
+
+int window;
+double wait_secs;
+
+// Run `round()` until `wait_secs` passes, returning operations per second.
+// `round` returns the number of operations it completed.
+template<typename Fn>
+double measure(Fn round) {
+  uint64_t ops = 0;
+  timer tim;
+  while(tim.elapsed() < wait_secs)
+    ops += round();
+  return ops/tim.elapsed();
+}
+
+template<typename T>
+void run(const char *width, T zero, T one, report *rep) {
+  upcxx::atomic_domain<T> ad({atomic_op::compare_exchange});
+
+  upcxx::dist_object<global_ptr<T>> dobj(upcxx::new_<T>(zero));
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+
+  // the first off-node and on-node peers, if any
+  intrank_t remote = -1, local = -1;
+  for(intrank_t r=1; r < n; r++) {
+    intrank_t p = (me + r) % n;
+    if(upcxx::local_team_contains(p)) { if(local < 0) local = p; }
+    else if(remote < 0) remote = p;
+  }
+
+  struct { const char *name; intrank_t who; } peers[] = {
+    {"self", me}, {"local", local}, {"remote", remote}
+  };
+
+  for(auto peer: peers) {
+    // every rank must take part in the barriers, so agree on who runs
+    int missing = upcxx::reduce_all(int(peer.who < 0), upcxx::op_fast_add).wait();
+    if(missing != 0) continue;
+
+    global_ptr<T> target = dobj.fetch(peer.who).wait();
+
+    upcxx::barrier();
+    double lat = measure([&]() {
+      (void)ad.compare_exchange(target, zero, one, memory_order_relaxed).wait();
+      return 1;
+    });
+
+    upcxx::barrier();
+    double bw = measure([&]() {
+      upcxx::promise<T> p;
+      for(int i=0; i < window; i++)
+        ad.compare_exchange(target, zero, one, memory_order_relaxed,
+                            upcxx::operation_cx::as_promise(p));
+      p.finalize().wait();
+      return window;
+    });
+
+    lat = upcxx::reduce_one(lat, upcxx::op_fast_add, 0).wait()/n;
+    bw = upcxx::reduce_one(bw, upcxx::op_fast_add, 0).wait()/n;
+
+    if(me == 0) {
+      rep->emit({"ops"}, column("ops", lat) & opnew_row() &
+                column("peer", peer.name) & column("width", width) & column("kind", "lat"));
+      rep->emit({"ops"}, column("ops", bw) & opnew_row() &
+                column("peer", peer.name) & column("width", width) & column("kind", "bw"));
+    }
+  }
+
+  upcxx::barrier();
+  upcxx::delete_(*dobj);
+  ad.destroy();
+}
+
+int main() {
+  upcxx::init();
+
+  window = os_env<int>("window", 64);
+  wait_secs = os_env<double>("wait_secs", 0.5);
+
+  report *rep = upcxx::rank_me() == 0 ? new report(__FILE__) : nullptr;
+
+  run<uint64_t>("8", 0, 1, rep);
+  run<tagged_ptr>("16", tagged_ptr{0, 0}, tagged_ptr{1, 1}, rep);
+
+  delete rep;
+
+  if (!upcxx::rank_me())  std::cout << "SUCCESS" << std::endl;
+  upcxx::finalize();
+  return 0;
+}
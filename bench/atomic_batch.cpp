@@ -0,0 +1,189 @@
+/*
+ * UPC++ benchmark: Batched atomics (distributed histogram)
+ *
+ * Every rank repeatedly adds random increments into a histogram whose bins
+ * are spread evenly across all ranks, comparing one atomic_domain::add per
+ * update against the batched interfaces.
+ *
+ * Reported dimensions:
+ *
+ *   bins: Total number of histogram bins across all ranks. Fewer bins means
+ *     more duplicates within a batch.
+ *
+ *   batch: Number of updates issued per round by each rank.
+ *
+ *   via = {single|batch|combined}: The mechanism used to apply a round.
+ *     single: One `add` per update, all tracked by a single promise.
+ *     batch: One `op_batch`.
+ *     combined: One `op_batch_combined`, folding duplicate bins locally.
+ *
+ * Reported measurements:
+ *
+ *   ops = Updates applied per second, summed over all ranks.
+ *
+ * Environment variables:
+ *
+ *   bins (integer list, default="1024 1048576"): List of total bin counts.
+ *
+ *   batch (integer list, default="1000 100000"): List of round sizes.
+ *
+ *   wait_secs (decimal, default=1): Number of seconds to run a given measurement.
+ */
+
+#include <upcxx/upcxx.hpp>
+
+#include "common/operator_new.hpp"
+#include "common/os_env.hpp"
+#include "common/report.hpp"
+#include "common/timer.hpp"
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using upcxx::atomic_op;
+using upcxx::global_ptr;
+using upcxx::intrank_t;
+
+using namespace std;
+using namespace bench;
+
+double wait_secs;
+
+using update_t = pair<global_ptr<uint64_t>, uint64_t>;
+
+struct measure {
+  double secs;
+  uint64_t ops;
+
+  static measure plus(measure a, measure b) {
+    return {a.secs + b.secs, a.ops + b.ops};
+  }
+};
+
+// Run `round()` repeatedly for `wait_secs`, recording the updates per second
+// at row `r` of `table`. `round` returns the number of updates it applied.
+template<typename Row, typename Fn>
+void run_trial(Row r, unordered_map<Row,measure> &table, Fn round) {
+  if(upcxx::rank_me() == 0)
+    cout<<"Measuring "<<r<<endl<<flush;
+
+  upcxx::barrier();
+
+  double total_secs = 0.0;
+  uint64_t ops = 0;
+  int64_t rounds = 4;
+
+  while(true) {
+    bool last = rounds < 4;
+    rounds = last ? 4 : rounds;
+
+    timer tim;
+    for(int64_t i=0; i < rounds; i++)
+      ops += round();
+    double dt = tim.elapsed();
+
+    total_secs += dt;
+    if(last) break;
+
+    // estimate number of rounds needed to spend 75% of our remaining time budget.
+    rounds = (double(rounds)/dt) * .75*(wait_secs - total_secs);
+    rounds = upcxx::reduce_all(rounds, upcxx::op_fast_min).wait();
+  }
+
+  table[r] = {total_secs, ops};
+}
+
+auto make_row = [](size_t bins, size_t batch, const char *via) {
+  return column("bins", bins)
+       & column("batch", batch)
+       & column("via", via);
+};
+
+int main() {
+  upcxx::init();
+
+  vector<size_t> bin_nums = os_env<vector<size_t>>("bins", vector<size_t>({1<<10, 1<<20}));
+  vector<size_t> batch_sizes = os_env<vector<size_t>>("batch", vector<size_t>({1000, 100000}));
+  wait_secs = os_env<double>("wait_secs", 1.0);
+
+  intrank_t rank_n = upcxx::rank_n();
+
+  upcxx::atomic_domain<uint64_t> ad({atomic_op::add});
+  unordered_map<decltype(make_row(0,0,0)), measure> table;
+
+  for(size_t bins: bin_nums) {
+    size_t per_rank = (bins + rank_n-1)/rank_n;
+    upcxx::dist_object<global_ptr<uint64_t>> mine(upcxx::new_array<uint64_t>(per_rank));
+
+    vector<global_ptr<uint64_t>> bases(rank_n);
+    for(intrank_t r=0; r < rank_n; r++)
+      bases[r] = mine.fetch(r).wait();
+
+    for(size_t batch: batch_sizes) {
+      mt19937_64 rng(upcxx::rank_me());
+      vector<update_t> ups(batch);
+      for(update_t &up: ups) {
+        size_t b = rng() % (per_rank*rank_n);
+        up = {bases[b/per_rank] + b%per_rank, 1 + rng() % 8};
+      }
+
+      run_trial(make_row(bins, batch, "single"), table, [&]() {
+        upcxx::promise<> p;
+        for(update_t const &up: ups)
+          ad.add(up.first, up.second, memory_order_relaxed, upcxx::operation_cx::as_promise(p));
+        p.finalize().wait();
+        return ups.size();
+      });
+      run_trial(make_row(bins, batch, "batch"), table, [&]() {
+        ad.op_batch(atomic_op::add, ups.begin(), ups.end(), memory_order_relaxed).wait();
+        return ups.size();
+      });
+      run_trial(make_row(bins, batch, "combined"), table, [&]() {
+        ad.op_batch_combined(atomic_op::add, ups.begin(), ups.end(), memory_order_relaxed).wait();
+        return ups.size();
+      });
+    }
+
+    upcxx::barrier();
+    upcxx::delete_array(*mine);
+  }
+
+  for(size_t bins: bin_nums) {
+    for(size_t batch: batch_sizes) {
+      for(const char *via: {"single","batch","combined"}) {
+        auto r = make_row(bins, batch, via);
+        table[r] = upcxx::reduce_all(table[r], measure::plus).wait();
+      }
+    }
+  }
+
+  if(upcxx::rank_me() == 0) {
+    report rep(__FILE__);
+
+    for(size_t bins: bin_nums) {
+      for(size_t batch: batch_sizes) {
+        for(const char *via: {"single","batch","combined"}) {
+          auto r = make_row(bins, batch, via);
+          measure m = table[r];
+          // secs were summed over ranks, so this is the aggregate rate
+          rep.emit({"ops"},
+            column("ops", m.ops/(m.secs/rank_n)) &
+            opnew_row() &
+            r
+          );
+        }
+
+        rep.blank();
+      }
+    }
+  }
+
+  ad.destroy();
+
+  if (!upcxx::rank_me())  std::cout << "SUCCESS" << std::endl;
+  upcxx::finalize();
+  return 0;
+}
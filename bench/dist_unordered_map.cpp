@@ -0,0 +1,158 @@
+/*
+ * UPC++ benchmark: Distributed hash map (k-mer counting pattern)
+ *
+ * Every rank counts a stream of random 64-bit keys into a distributed map
+ * and then looks each of them up again, comparing the one-RPC-per-operation
+ * map from example/prog-guide/dmap-promises.hpp against
+ * upcxx::dist_unordered_map.
+ *
+ * Reported dimensions:
+ *
+ *   op = {update|find}: Count one occurrence of a key, or look it up.
+ *
+ *   via = {rpc|batched}:
+ *     rpc: One RPC per operation into a dist_object<std::unordered_map>,
+ *       all tracked by a single promise, as in the programmer's guide.
+ *     batched: dist_unordered_map with the given `batch`, then flush().
+ *
+ *   batch: Operations per destination per RPC (1 for via=rpc).
+ *
+ * Reported measurements:
+ *
+ *   ops = Operations completed per second, summed over all ranks.
+ *
+ * Environment variables:
+ *
+ *   keys (integer, default=100000): Keys counted by each rank.
+ *
+ *   distinct (integer, default=1000000): Size of the key space.
+ *
+ *   batch (integer list, default="64 1024 16384"): List of batch sizes.
+ */
+
+#include <upcxx/upcxx.hpp>
+
+#include "common/operator_new.hpp"
+#include "common/os_env.hpp"
+#include "common/report.hpp"
+#include "common/timer.hpp"
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using upcxx::intrank_t;
+
+using namespace std;
+using namespace bench;
+
+// The programmer's guide map, with counting in place of insert.
+class rpc_map {
+  using dobj_map_t = upcxx::dist_object<unordered_map<uint64_t, uint64_t>>;
+  dobj_map_t local_map;
+
+  intrank_t target_rank(uint64_t key) {
+    return std::hash<uint64_t>{}(key) % upcxx::rank_n();
+  }
+
+public:
+  rpc_map(): local_map({}) {}
+
+  void update(uint64_t key, upcxx::promise<> &prom) {
+    upcxx::rpc(target_rank(key), upcxx::operation_cx::as_promise(prom),
+      [](dobj_map_t &lmap, uint64_t key) {
+        (*lmap)[key] += 1;
+      }, local_map, key);
+  }
+
+  upcxx::future<uint64_t> find(uint64_t key) {
+    return upcxx::rpc(target_rank(key),
+      [](dobj_map_t &lmap, uint64_t key) -> uint64_t {
+        auto elem = lmap->find(key);
+        return elem == lmap->end() ? 0 : elem->second;
+      }, local_map, key);
+  }
+};
+
+// Time `fn()` between barriers, returning aggregate operations per second
+// for `ops` operations per rank.
+template<typename Fn>
+double measure(size_t ops, Fn fn) {
+  upcxx::barrier();
+  timer tim;
+  fn();
+  upcxx::barrier();
+  double secs = tim.elapsed();
+  return upcxx::reduce_all(ops/secs, upcxx::op_fast_add).wait();
+}
+
+int main() {
+  upcxx::init();
+
+  size_t key_n = os_env<size_t>("keys", 100000);
+  uint64_t distinct = os_env<uint64_t>("distinct", 1000000);
+  vector<size_t> batch_sizes = os_env<vector<size_t>>("batch", vector<size_t>({64, 1024, 16384}));
+
+  mt19937_64 rng(upcxx::rank_me());
+  vector<uint64_t> keys(key_n);
+  for(uint64_t &k: keys)
+    k = rng() % distinct;
+
+  report *rep = upcxx::rank_me() == 0 ? new report(__FILE__) : nullptr;
+
+  auto emit = [&](const char *op, const char *via, size_t batch, double ops) {
+    if(rep)
+      rep->emit({"ops"}, column("ops", ops) & opnew_row() &
+                column("op", op) & column("via", via) & column("batch", batch));
+  };
+
+  {
+    rpc_map m;
+    double up = measure(keys.size(), [&]() {
+      upcxx::promise<> p;
+      for(uint64_t k: keys)
+        m.update(k, p);
+      p.finalize().wait();
+    });
+    uint64_t found = 0;
+    double fd = measure(keys.size(), [&]() {
+      upcxx::promise<> p;
+      for(uint64_t k: keys) {
+        p.require_anonymous(1);
+        m.find(k).then([&](uint64_t c) {
+          found += c != 0;
+          p.fulfill_anonymous(1);
+        });
+      }
+      p.finalize().wait();
+    });
+    UPCXX_ASSERT_ALWAYS(found == keys.size());
+    emit("update", "rpc", 1, up);
+    emit("find", "rpc", 1, fd);
+  }
+
+  for(size_t batch: batch_sizes) {
+    upcxx::dist_unordered_map<uint64_t, uint64_t> m(batch);
+    double up = measure(keys.size(), [&]() {
+      for(uint64_t k: keys)
+        m.update(k, 1);
+      m.flush().wait();
+    });
+    uint64_t found = 0;
+    double fd = measure(keys.size(), [&]() {
+      for(uint64_t k: keys)
+        m.find(k).then([&](bool hit, uint64_t) { found += hit; });
+      m.flush().wait();
+    });
+    UPCXX_ASSERT_ALWAYS(found == keys.size());
+    emit("update", "batched", batch, up);
+    emit("find", "batched", batch, fd);
+  }
+
+  delete rep;
+
+  if (!upcxx::rank_me())  std::cout << "SUCCESS" << std::endl;
+  upcxx::finalize();
+  return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * UPC++ benchmark: Multi-producer lpc throughput
+ *
+ * Several threads send lpc's to the master persona while the primordial
+ * thread drains them with progress(), stressing the persona's MPSC inbox
+ * from both ends. Companion to test/lpc-stress.cpp, which checks the
+ * correctness of the same traffic.
+ *
+ * Reported dimensions:
+ *
+ *   producers: Number of sending threads.
+ *
+ *   kind = {ff|roundtrip}:
+ *     ff: `lpc_ff`, each producer sends without waiting.
+ *     roundtrip: `lpc` and wait on its future, so each producer's persona
+ *       also receives one completion lpc per message.
+ *
+ * Reported measurements:
+ *
+ *   lpcs = lpc's executed by the master persona per second, summed over all
+ *     ranks.
+ *
+ * Environment variables:
+ *
+ *   iters (integer, default=100000): lpc's sent by each producer.
+ *
+ *   producers (integer list, default="1 2 4 8"): List of producer counts.
+ */
+
+#include <upcxx/upcxx.hpp>
+
+#include "common/operator_new.hpp"
+#include "common/os_env.hpp"
+#include "common/report.hpp"
+#include "common/timer.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace bench;
+
+int main() {
+  upcxx::init();
+
+  uint64_t iters = os_env<uint64_t>("iters", 100000);
+  vector<int> producer_ns = os_env<vector<int>>("producers", vector<int>({1, 2, 4, 8}));
+
+  report *rep = upcxx::rank_me() == 0 ? new report(__FILE__) : nullptr;
+
+  for(int roundtrip=0; roundtrip <= 1; roundtrip++) {
+    for(int producers: producer_ns) {
+      // only touched by the master persona
+      uint64_t executed = 0;
+      uint64_t expect = iters*producers;
+
+      atomic<int> ready(0);
+      atomic<bool> go(false);
+      vector<thread> th;
+
+      for(int t=0; t < producers; t++) {
+        th.emplace_back([&]() {
+          upcxx::persona &master = upcxx::master_persona();
+          ready.fetch_add(1);
+          while(!go.load(memory_order_acquire))
+            this_thread::yield();
+
+          if(roundtrip) {
+            for(uint64_t i=0; i < iters; i++)
+              master.lpc([&]() { executed += 1; }).wait();
+          }
+          else {
+            for(uint64_t i=0; i < iters; i++)
+              master.lpc_ff([&]() { executed += 1; });
+          }
+        });
+      }
+
+      while(ready.load() != producers)
+        this_thread::yield();
+
+      upcxx::barrier();
+      timer tim;
+      go.store(true, memory_order_release);
+
+      while(executed != expect)
+        upcxx::progress();
+
+      double secs = tim.elapsed();
+
+      for(thread &t: th)
+        t.join();
+
+      double lpcs = upcxx::reduce_all(expect/secs, upcxx::op_fast_add).wait();
+
+      if(rep)
+        rep->emit({"lpcs"}, column("lpcs", lpcs) & opnew_row() &
+                  column("producers", producers) &
+                  column("kind", roundtrip ? "roundtrip" : "ff"));
+    }
+  }
+
+  delete rep;
+
+  if (!upcxx::rank_me())  std::cout << "SUCCESS" << std::endl;
+  upcxx::finalize();
+  return 0;
+}
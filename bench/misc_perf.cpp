@@ -2,6 +2,10 @@
 // focusing on CPU overheads.
 //
 // Usage: a.out (iterations)
+//
+// Per-operation completion objects and future cells come from a per-thread
+// object pool. Run once with UPCXX_OBJECT_POOL=0 to measure the rows below
+// with the system allocator instead.
 
 #include <upcxx/upcxx.hpp>
 #include <gasnetex.h>
@@ -183,6 +187,13 @@ void doit2() {
     gp = *dod;
     gp_peer = dod.fetch(peer).wait();
     TIME_OPERATION("upcxx::rput<double>(self)",upcxx::rput(0.,gp).wait());
+    TIME_OPERATION("upcxx::rget<double>(self)",upcxx::rget(gp).wait());
+    TIME_OPERATION("upcxx::promise<> construct/finalize",upcxx::promise<>().finalize().wait());
+    { upcxx::promise<> p;
+      TIME_OPERATION("upcxx::rput<double>(self, promise) overhead",
+                     upcxx::rput(0.,gp, upcxx::operation_cx::as_promise(p)));
+      p.finalize().wait();
+    }
     {
       static int flag;
       TIME_OPERATION("upcxx::rput<double>(self, RC)", 
@@ -27,6 +27,10 @@
  *     on the other dimensions. Even the "op=put_lat" present their throughput
  *     measurement as bandwidth.
  * 
+ *   polls, wasted_polls = (how=upcxx* only) The number of put handle tests
+ *     made by upcxx progress per put issued, and how many of those found the
+ *     handle not yet ready.
+ * 
  * Compile-time parameters (like -Dfoo=bar):
  *   
  *   PROGRESS_PERIOD=<int>: The number of PUTs to issue between calls to 
@@ -63,6 +67,7 @@
 #include <iostream>
 #include <list>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <cstdio>
@@ -92,12 +97,22 @@ int fixed_iters;
 // maps rank to blob address
 vector<global_ptr<char>> blobs;
 
+// Snapshot of the runtime's poll counters for put handles.
+upcxx::backend::gasnet::handle_cb_poll_stats put_poll_stats() {
+  return upcxx::backend::gasnet::get_handle_cb_queue().poll_stats(
+    upcxx::backend::gasnet::handle_cb_class::rma_put
+  );
+}
+
 // Runs `inject(T* src, global_ptr<T> dest, size_t size, int iters)` in a
 // loop until the measurement termination condition is met. Then runs
 // `finish()`, after which the timer is queried and total bandwidth is 
-// returned.
+// returned. If `polls` is given it receives the put handle tests and misses
+// per op.
 template<typename Inject, typename Finish>
-double run_trial_bw(int peer, size_t size, Inject inject, Finish finish) {
+double run_trial_bw(int peer, size_t size, Inject inject, Finish finish,
+                    std::pair<double,double> *polls = nullptr) {
+  auto stats0 = put_poll_stats();
   timer tim;
   int64_t ops = 0;
 
@@ -121,6 +136,12 @@ double run_trial_bw(int peer, size_t size, Inject inject, Finish finish) {
   
   // return bytes/sec
   double secs = tim.elapsed();
+
+  if(polls) {
+    auto stats1 = put_poll_stats();
+    polls->first = double(stats1.tests - stats0.tests)/ops;
+    polls->second = double(stats1.misses - stats0.misses)/ops;
+  }
   return ops*size/secs;
 }
 
@@ -210,6 +231,7 @@ int main() {
     using row_t = decltype(make_row(0,0,0,0));
     
     std::unordered_map<row_t, double> bw_table;
+    std::unordered_map<row_t, std::pair<double,double>> poll_table;
     
     for(int peer_ix=0; peer_ix < peer_n; peer_ix++) {
       const int peer = peers[peer_ix];
@@ -225,7 +247,8 @@ int main() {
               while(iters--)
                 upcxx::rput(src, dest, size).wait();
             },
-            [](){}
+            [](){},
+            &poll_table[make_row(peer, size, "lat", "upcxx")]
           );
           
           bw_table[make_row(peer, size, "lat", "upcxx")] = bw;
@@ -273,7 +296,8 @@ int main() {
                   upcxx::progress();
               }
             },
-            [&]() { pro.finalize().wait(); }
+            [&]() { pro.finalize().wait(); },
+            &poll_table[make_row(peer, size, "bw", "upcxx-pro")]
           );
           
           bw_table[make_row(peer, size, "bw", "upcxx-pro")] = bw;
@@ -303,7 +327,8 @@ int main() {
                 futs.front().wait();
                 futs.pop_front();
               }
-            }
+            },
+            &poll_table[make_row(peer, size, "bw", "upcxx-fut")]
           );
           
           bw_table[make_row(peer, size, "bw", "upcxx-fut")] = bw;
@@ -390,11 +415,22 @@ int main() {
             auto r = make_row(peers[peer_ix], size, kind, how);
             
             if(bw_table.count(r)) { // in case one of the trials is disabled via "if(0) ..."
-              rep.emit({"bw"},
-                r & opnew_row()
-                  & column("progress_period", PROGRESS_PERIOD)
-                  & column("bw", bw_table[r])
-              );
+              if(poll_table.count(r)) {
+                rep.emit({"bw","polls","wasted_polls"},
+                  r & opnew_row()
+                    & column("progress_period", PROGRESS_PERIOD)
+                    & column("bw", bw_table[r])
+                    & column("polls", poll_table[r].first)
+                    & column("wasted_polls", poll_table[r].second)
+                );
+              }
+              else {
+                rep.emit({"bw"},
+                  r & opnew_row()
+                    & column("progress_period", PROGRESS_PERIOD)
+                    & column("bw", bw_table[r])
+                );
+              }
             }
           }
         }
@@ -1,5 +1,7 @@
 // This micro-benchmark measures the performance of selected RPC protocols across payload size
 // Reported sizes are a view-based user-level payload, and somewhat undercount the actual size on-the-wire
+// It also measures the dispatch cost of RPCs binding a dist_object& argument, with a
+// configurable number of other live dist_objects populating the registry
 //
 
 #ifndef USE_WINDOW
@@ -11,6 +13,7 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 #include <assert.h>
 #include <unistd.h>
 #include "common/timer.hpp"
@@ -21,6 +24,7 @@ int nranks, self, peer;
 uint64_t iters;
 uint64_t maxsz;
 uint64_t windowsz;
+uint64_t live_dobjs;
 const int szscale = 2;
 
 char *payload;
@@ -182,7 +186,56 @@ void run_test(bool iamprimary, const char *desc) {
   } // sz
 } // run_test
 
-// Usage: a.out (iterations) <window_size> <max_payload>
+// Empty round-trip rpc() latency with and without a dist_object& argument, so the
+// difference is the cost of resolving the object on the target.
+void run_dobj_test(bool iamprimary, uint64_t live) {
+  if (!upcxx::rank_me()) {
+    std::cout << "*** Testing dist_object rpc dispatch, " << live << " other live dist_objects" << std::endl;
+    std::cout << "     "
+              << std::right << std::setw(10) << "Argument"
+              << " "
+              << std::right << std::setw(14) << "Total time"
+              << "    "
+              << "Round-trip Latency"
+              << std::endl;
+  }
+
+  std::vector<std::unique_ptr<dist_object<int>>> others;
+  for (uint64_t i = 0; i < live; i++)
+    others.emplace_back(new dist_object<int>(int(i)));
+  dist_object<int> dobj(self);
+
+  for (int with_dobj = 0; with_dobj < 2; with_dobj++) {
+    barrier();
+    bench::timer start;
+
+    if (iamprimary) {
+      for (uint64_t i = 0; i < iters; i++) {
+        if (with_dobj)
+          rpc(peer, [](dist_object<int> &d) -> void { assert(*d == self); }, dobj).wait();
+        else
+          rpc(peer, []() -> void { return; }).wait();
+      }
+    }
+
+    barrier();
+
+    if (iamprimary) {
+      double total_time = start.elapsed();
+      double lat = (total_time / iters) * 1e6;
+      std::stringstream ss;
+      ss << std::setw(3) << self << ": "
+         << std::setw(10) << (with_dobj ? "dist_obj" : "none") << " "
+         << std::setw(14) << total_time << " s "
+         << std::setw(10) << lat << " us\n";
+      std::cout << ss.str() << std::flush;
+    }
+  }
+
+  barrier(); // ensure dist_object lifetime
+}
+
+// Usage: a.out (iterations) <window_size> <max_payload> <live_dist_objects>
 // Compiling with -DUSE_WINDOW=0 disables windowing (and window argument)
 int main(int argc, char **argv) {
   upcxx::init();
@@ -205,6 +258,7 @@ int main(int argc, char **argv) {
     assert(iters % windowsz == 0);
   #endif
     PARSE_ARG(maxsz, 4*1024*1024);
+    PARSE_ARG(live_dobjs, 1000);
   }
 
   nranks = upcxx::rank_n();
@@ -248,6 +302,9 @@ int main(int argc, char **argv) {
     run_test<true, true, true>(iamprimary, "rpc_ff bi-directional flood bandwidth (many-at-a-time)");
   }
 
+  upcxx::barrier();
+  run_dobj_test(iamprimary, live_dobjs);
+
   upcxx::barrier();
   if (!upcxx::rank_me()) std::cout << "SUCCESS" << std::endl;
 
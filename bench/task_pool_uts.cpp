@@ -0,0 +1,147 @@
+/*
+ * UPC++ benchmark: Unbalanced Tree Search over upcxx::task_pool
+ *
+ * Rank 0 seeds the root of the tree from test/uts/uts.cpp and every node
+ * is a task spawning its children, so all other ranks and threads only get
+ * work by stealing it. Run with varying rank counts and `threads` for the
+ * strong scaling curves.
+ *
+ * Reported dimensions:
+ *
+ *   ranks: Number of ranks.
+ *
+ *   threads: Worker threads per rank (including the master).
+ *
+ *   width: UTS_WIDTH used to shape the tree.
+ *
+ *   node_work: Hash rounds spent per node to simulate work.
+ *
+ * Reported measurements:
+ *
+ *   nodes = Tree nodes processed per second, over all ranks.
+ *
+ * Environment variables:
+ *
+ *   width (float, default=10000): UTS_WIDTH of the tree (about 250k nodes).
+ *
+ *   node_work (integer, default=100): Hash rounds per node.
+ *
+ *   threads (integer list, default="1 2 4"): List of threads per rank. A
+ *     value greater than 1 needs UPCXX_THREADMODE=par unless the handler
+ *     makes no UPC++ calls, which is the case here.
+ */
+
+#include <upcxx/upcxx.hpp>
+
+#include "common/operator_new.hpp"
+#include "common/os_env.hpp"
+#include "common/report.hpp"
+#include "common/timer.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using upcxx::digest;
+
+using namespace std;
+using namespace bench;
+
+struct uts_node {
+  digest id;
+  int depth;
+};
+
+double uts_width;
+int node_work;
+
+int uts_kid_n(uts_node nd) {
+  if(nd.depth == 0)
+    return 100;
+
+  double expected = nd.depth < 5 ? std::pow(uts_width/100, 0.25) :
+                    nd.depth < 30 ? 1.0 :
+                    0.1;
+
+  return (500 +
+      nd.id.w0 % int(1000*expected) +
+      nd.id.w1 % int(1000*expected)
+    )/1000;
+}
+
+uint64_t serial_node_n() {
+  uint64_t n = 0;
+  vector<uts_node> work{uts_node{digest{0xdeadbeef, 0xdeadbeef}, 0}};
+  while(!work.empty()) {
+    uts_node nd = work.back();
+    work.pop_back();
+    n += 1;
+    for(int k=0; k != uts_kid_n(nd); k++)
+      work.push_back(uts_node{nd.id.eat(k, nd.depth), nd.depth + 1});
+  }
+  return n;
+}
+
+atomic<uint64_t> node_n{0};
+atomic<uint64_t> sink{0};
+
+void visit(upcxx::task_pool<uts_node> &pool, uts_node &&nd) {
+  digest h = nd.id;
+  for(int i=0; i < node_work; i++)
+    h = h.eat(i);
+  sink.fetch_xor(h.w0, memory_order_relaxed);
+
+  node_n.fetch_add(1, memory_order_relaxed);
+
+  int kid_n = uts_kid_n(nd);
+  for(int k=0; k != kid_n; k++)
+    pool.spawn(uts_node{nd.id.eat(k, nd.depth), nd.depth + 1});
+}
+
+int main() {
+  upcxx::init();
+
+  uts_width = os_env<double>("width", 10000);
+  node_work = os_env<int>("node_work", 100);
+  vector<int> thread_ns = os_env<vector<int>>("threads", vector<int>({1, 2, 4}));
+
+  uint64_t expect = serial_node_n();
+
+  report *rep = upcxx::rank_me() == 0 ? new report(__FILE__) : nullptr;
+
+  for(int threads: thread_ns) {
+    node_n = 0;
+    upcxx::task_pool<uts_node> pool(visit, upcxx::world(), threads);
+
+    upcxx::barrier();
+    timer tim;
+
+    if(upcxx::rank_me() == 0)
+      pool.spawn(uts_node{digest{0xdeadbeef, 0xdeadbeef}, 0});
+
+    vector<thread> helpers;
+    for(int t=1; t < threads; t++)
+      helpers.emplace_back([&]() { pool.run(); });
+    pool.run();
+    for(thread &t: helpers)
+      t.join();
+
+    double secs = tim.elapsed();
+    uint64_t total = upcxx::reduce_all(node_n.load(), upcxx::op_fast_add).wait();
+    secs = upcxx::reduce_all(secs, upcxx::op_fast_max).wait();
+    UPCXX_ASSERT_ALWAYS(total == expect, "processed " << total << " of " << expect << " nodes");
+
+    if(rep)
+      rep->emit({"nodes"}, column("nodes", total/secs) & opnew_row() &
+                column("ranks", upcxx::rank_n()) & column("threads", threads) &
+                column("width", uts_width) & column("node_work", node_work));
+  }
+
+  delete rep;
+
+  if (!upcxx::rank_me())  std::cout << "SUCCESS" << std::endl;
+  upcxx::finalize();
+  return 0;
+}
@@ -3,6 +3,7 @@
 #
 
 libupcxx_sources = \
+	backend/gasnet/node_coll.cpp \
 	backend/gasnet/noise_log.cpp \
 	backend/gasnet/runtime.cpp   \
 	backend/gasnet/upc_link.c    \
@@ -11,11 +12,15 @@ libupcxx_sources = \
 	atomic.cpp                   \
 	barrier.cpp                  \
 	broadcast.cpp                \
+	comm_plan.cpp                \
 	copy.cpp                     \
 	cuda.cpp                     \
 	diagnostic.cpp               \
 	digest.cpp                   \
 	global_fnptr.cpp             \
+	nbi.cpp                      \
+	notify_counter.cpp           \
+	object_pool.cpp              \
 	os_env.cpp                   \
 	persona.cpp                  \
 	reduce.cpp                   \
@@ -23,6 +28,7 @@ libupcxx_sources = \
 	rput.cpp                     \
 	segment_allocator.cpp        \
 	serialization.cpp            \
+	task_pool.cpp                \
 	team.cpp                     \
 	upcxx.cpp                    \
 	vis.cpp                      \
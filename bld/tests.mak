@@ -162,6 +162,7 @@ test_exclude_par += \
 	test/regression/issue133.cpp
 # PAR-only tests:
 test_exclude_seq += \
+	test/alloc_threads.cpp \
 	test/hello_threads.cpp \
 	test/rput_thread.cpp \
 	test/rput_omp.cpp \
@@ -218,7 +219,10 @@ endif
 test_seq_threaded = \
 	VIEW \
 	LPC_BARRIER \
-	LPC_STRESS
+	LPC_FLOOD \
+	LPC_STRESS \
+	TASK_POOL \
+	TASK_POOL_UTS
 $(foreach test,$(test_seq_threaded), \
   $(eval export TEST_FLAGS_$(test):=$(TEST_FLAGS_$(test)) $(TEST_THREADED_FLAGS)))
 
@@ -231,6 +235,8 @@ $(foreach test,$(test_seq_threaded), \
 
 # Tweak benchmarks for efficient coverage, these parameters are too small for good measurements
 export TEST_ENV_PUT_FLOOD=fixed_iters=10
+export TEST_ENV_LPC_FLOOD=iters=1000 producers=2
+export TEST_ENV_TASK_POOL_UTS=width=1000 node_work=10 threads=2
 export TEST_ARGS_CUDA_MICROBENCHMARK='-t 1 -w 1'
 export TEST_ARGS_MISC_PERF='1000'
 export TEST_ARGS_RPC_PERF='100 10 1048576'
@@ -6,6 +6,10 @@
   #include <gasnet_ratomic.h>
 #endif
 
+#include <upcxx/nbi.hpp>
+
+#include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <string>
 
@@ -126,6 +130,227 @@ gex_Event_t atomic_domain_untyped<8,2>::inject(
 
 } } // namespace upcxx::detail
   
+namespace {
+  // gex_AD_OpNBI_* overloaded on the proxy type
+  #define NBI_OVERLOAD(T, SUFFIX) \
+    inline void ad_op_nbi(gex_AD_t ad, T *result, intrank_t jobrank, void *raw_ptr, \
+                          gex_OP_t op, T val, gex_Flags_t flags) { \
+      gex_AD_OpNBI_##SUFFIX(ad, result, jobrank, raw_ptr, op, val, 0, flags); \
+    }
+  NBI_OVERLOAD(uint32_t, U32)
+  NBI_OVERLOAD(int32_t,  I32)
+  NBI_OVERLOAD(float,    FLT)
+  NBI_OVERLOAD(uint64_t, U64)
+  NBI_OVERLOAD(int64_t,  I64)
+  NBI_OVERLOAD(double,   DBL)
+  #undef NBI_OVERLOAD
+
+  bool is_fetching(atomic_op op) {
+    switch(op) {
+    case atomic_op::load: case atomic_op::compare_exchange:
+    case atomic_op::fetch_add: case atomic_op::fetch_sub:
+    case atomic_op::fetch_inc: case atomic_op::fetch_dec:
+    case atomic_op::fetch_mul: case atomic_op::fetch_min: case atomic_op::fetch_max:
+    case atomic_op::fetch_bit_and: case atomic_op::fetch_bit_or: case atomic_op::fetch_bit_xor:
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  // Integer folding is done unsigned so that it wraps like the network
+  // atomics would instead of overflowing.
+  template<typename P, bool integral = std::is_integral<P>::value>
+  struct fold_type { using type = P; };
+  template<typename P>
+  struct fold_type<P, true> { using type = typename std::make_unsigned<P>::type; };
+
+  template<typename P>
+  P fold_bits(atomic_op op, P a, P b, std::true_type/*integral*/) {
+    switch(op) {
+    case atomic_op::bit_and: return a & b;
+    case atomic_op::bit_or:  return a | b;
+    default:                 return a ^ b;
+    }
+  }
+  template<typename P>
+  P fold_bits(atomic_op, P a, P, std::false_type/*integral*/) {
+    UPCXX_ASSERT(0, "bitwise atomic on floating-point type");
+    return a;
+  }
+
+  // Combine the operands of two applications of `op` to the same location.
+  template<typename P>
+  P fold(atomic_op op, P a, P b) {
+    using U = typename fold_type<P>::type;
+    switch(op) {
+    case atomic_op::add:
+    case atomic_op::sub: return static_cast<P>(static_cast<U>(a) + static_cast<U>(b));
+    case atomic_op::mul: return static_cast<P>(static_cast<U>(a) * static_cast<U>(b));
+    case atomic_op::min: return b < a ? b : a;
+    case atomic_op::max: return a < b ? b : a;
+    default:             return fold_bits(op, a, b, std::is_integral<P>());
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // CPU atomics for atomic_domain_mode::native_local
+
+  // std::atomic refuses some orderings for pure loads and stores.
+  std::memory_order load_order(std::memory_order order) {
+    return order == std::memory_order_release ? std::memory_order_relaxed :
+           order == std::memory_order_acq_rel ? std::memory_order_acquire :
+           order;
+  }
+  std::memory_order store_order(std::memory_order order) {
+    return order == std::memory_order_acquire ? std::memory_order_relaxed :
+           order == std::memory_order_acq_rel ? std::memory_order_release :
+           order;
+  }
+
+  // Read-modify-write through a CAS loop, returning the prior value.
+  template<typename P, typename Fn>
+  P cas_rmw(std::atomic<P> *a, std::memory_order order, Fn fn) {
+    P old = a->load(std::memory_order_relaxed);
+    while(!a->compare_exchange_weak(old, fn(old), order, load_order(order)))
+      {}
+    return old;
+  }
+
+  template<typename P>
+  P native_add(std::atomic<P> *a, P val, std::memory_order order, std::true_type/*integral*/) {
+    return a->fetch_add(val, order);
+  }
+  template<typename P>
+  P native_add(std::atomic<P> *a, P val, std::memory_order order, std::false_type/*integral*/) {
+    return cas_rmw(a, order, [=](P x) { return x + val; });
+  }
+
+  template<typename P>
+  P native_sub(std::atomic<P> *a, P val, std::memory_order order, std::true_type/*integral*/) {
+    return a->fetch_sub(val, order);
+  }
+  template<typename P>
+  P native_sub(std::atomic<P> *a, P val, std::memory_order order, std::false_type/*integral*/) {
+    return cas_rmw(a, order, [=](P x) { return x - val; });
+  }
+
+  template<typename P>
+  P native_bits(std::atomic<P> *a, atomic_op op, P val, std::memory_order order, std::true_type/*integral*/) {
+    switch(op) {
+    case atomic_op::bit_and: case atomic_op::fetch_bit_and: return a->fetch_and(val, order);
+    case atomic_op::bit_or:  case atomic_op::fetch_bit_or:  return a->fetch_or(val, order);
+    default:                                                return a->fetch_xor(val, order);
+    }
+  }
+  template<typename P>
+  P native_bits(std::atomic<P> *a, atomic_op, P, std::memory_order, std::false_type/*integral*/) {
+    UPCXX_ASSERT(0, "bitwise atomic on floating-point type");
+    return a->load();
+  }
+}
+
+template<std::size_t size, int bit_flavor>
+typename upcxx::detail::atomic_domain_untyped<size,bit_flavor>::proxy_type
+upcxx::detail::atomic_domain_untyped<size,bit_flavor>::inject_local(
+    void *addr, atomic_op opcode, proxy_type val1, proxy_type val2,
+    std::memory_order order) {
+  using P = proxy_type;
+  using integral = std::is_integral<P>;
+  static_assert(sizeof(std::atomic<P>) == sizeof(P),
+    "native_local atomics require std::atomic to share the proxy type's layout");
+
+  std::atomic<P> *a = reinterpret_cast<std::atomic<P>*>(addr);
+
+  switch(opcode) {
+  case atomic_op::load:
+    return a->load(load_order(order));
+  case atomic_op::store:
+    a->store(val1, store_order(order));
+    return val1;
+  case atomic_op::compare_exchange:
+    a->compare_exchange_strong(val1, val2, order, load_order(order));
+    return val1; // the prior value either way
+  case atomic_op::add: case atomic_op::fetch_add:
+    return native_add(a, val1, order, integral());
+  case atomic_op::sub: case atomic_op::fetch_sub:
+    return native_sub(a, val1, order, integral());
+  case atomic_op::inc: case atomic_op::fetch_inc:
+    return native_add(a, P(1), order, integral());
+  case atomic_op::dec: case atomic_op::fetch_dec:
+    return native_sub(a, P(1), order, integral());
+  case atomic_op::mul: case atomic_op::fetch_mul:
+    return cas_rmw(a, order, [=](P x) { return fold(atomic_op::mul, x, val1); });
+  case atomic_op::min: case atomic_op::fetch_min:
+    return cas_rmw(a, order, [=](P x) { return val1 < x ? val1 : x; });
+  case atomic_op::max: case atomic_op::fetch_max:
+    return cas_rmw(a, order, [=](P x) { return x < val1 ? val1 : x; });
+  default:
+    return native_bits(a, opcode, val1, order, integral());
+  }
+}
+
+template<std::size_t size, int bit_flavor>
+gex_Event_t upcxx::detail::atomic_domain_untyped<size,bit_flavor>::inject_batch(
+    std::uintptr_t ad, atomic_op opcode, batch_elt *elts, std::size_t n,
+    bool combine, bool native_local, std::memory_order order,
+    gex_Flags_t flags) {
+  UPCXX_ASSERT_MASTER_IFSEQ();
+  UPCXX_ASSERT_ALWAYS(!upcxx::nbi_in_region(),
+    "Batched atomic operations may not be issued inside an nbi_begin()/nbi_end() region.");
+  UPCXX_ASSERT(opcode != atomic_op::compare_exchange,
+    "compare_exchange is not supported by batched atomic operations");
+  UPCXX_ASSERT(n == 0 || is_fetching(opcode) == (elts[0].result != nullptr),
+    "Atomic operation '" << atomic_op_str(opcode) << "' " <<
+    (is_fetching(opcode) ? "requires fetch_op_batch()" : "may not be used with fetch_op_batch()"));
+
+  if(n == 0)
+    return GEX_EVENT_INVALID;
+
+  // Group by target so consecutive injections go to the same peer, and
+  // duplicates become adjacent.
+  std::sort(elts, elts + n, [](batch_elt const &a, batch_elt const &b) {
+    return a.jobrank < b.jobrank || (a.jobrank == b.jobrank && a.raw_ptr < b.raw_ptr);
+  });
+
+  if(combine) {
+    UPCXX_ASSERT(
+      opcode == atomic_op::add || opcode == atomic_op::sub ||
+      opcode == atomic_op::mul || opcode == atomic_op::min || opcode == atomic_op::max ||
+      opcode == atomic_op::bit_and || opcode == atomic_op::bit_or || opcode == atomic_op::bit_xor,
+      "Atomic operation '" << atomic_op_str(opcode) << "' can not be combined"
+    );
+
+    std::size_t m = 0;
+    for(std::size_t i=1; i < n; i++) {
+      if(elts[i].jobrank == elts[m].jobrank && elts[i].raw_ptr == elts[m].raw_ptr)
+        elts[m].val = fold(opcode, elts[m].val, elts[i].val);
+      else
+        elts[++m] = elts[i];
+    }
+    n = m + 1;
+  }
+
+  gex_NBI_BeginAccessRegion(/*flags*/0);
+  
+  for(std::size_t i=0; i < n; i++) {
+    if(native_local && backend::rank_is_local(elts[i].jobrank)) {
+      proxy_type prior = inject_local(
+        backend::localize_memory_nonnull(elts[i].jobrank, reinterpret_cast<std::uintptr_t>(elts[i].raw_ptr)),
+        opcode, elts[i].val, 0, order
+      );
+      if(elts[i].result)
+        *elts[i].result = prior;
+    }
+    else
+      ad_op_nbi(reinterpret_cast<gex_AD_t>(ad), elts[i].result,
+                elts[i].jobrank, elts[i].raw_ptr,
+                static_cast<gex_OP_t>(opcode), elts[i].val, flags);
+  }
+  
+  return gex_NBI_EndAccessRegion(/*flags*/0);
+}
+
 namespace {
 
   // check a handful of enum mappings to ensure no insert/delete errors
@@ -139,7 +364,7 @@ namespace {
 
 template<std::size_t size, int bit_flavor>
 upcxx::detail::atomic_domain_untyped<size,bit_flavor>::atomic_domain_untyped(
-  std::vector<atomic_op> const &ops, const team &tm) {
+  std::vector<atomic_op> const &ops, const team &tm, atomic_domain_mode mode) {
   UPCXX_ASSERT_MASTER();
 
   gex_OP_t opmask = 0;
@@ -154,6 +379,20 @@ upcxx::detail::atomic_domain_untyped<size,bit_flavor>::atomic_domain_untyped(
   }
 
   parent_tm_ = &tm;
+
+  if(mode == atomic_domain_mode::native_local) {
+    // These conduits implement gex_AD with the target's CPU (locally, or in
+    // an AM handler for remote peers), so our CPU atomics are coherent with
+    // theirs. Elsewhere the NIC may be involved, and we can only bypass if
+    // no member is off-node. Either way every member decides the same.
+    #if GASNET_CONDUIT_SMP || GASNET_CONDUIT_UDP || GASNET_CONDUIT_MPI || GASNET_CONDUIT_IBV
+      native_local_ = true;
+    #else
+      native_local_ = true;
+      for(intrank_t i=0; i < tm.rank_n() && native_local_; i++)
+        native_local_ = backend::rank_is_local(tm[i]);
+    #endif
+  }
   
   if(opmask) {
     #if GASNET_DEBUG
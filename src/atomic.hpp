@@ -2,6 +2,7 @@
 #define _4fd2caba_e406_4f0e_ab34_0e0224ec36a5
 
 #include <upcxx/backend.hpp>
+#include <upcxx/bind.hpp>
 #include <upcxx/completion.hpp>
 #include <upcxx/global_ptr.hpp>
 
@@ -11,6 +12,7 @@
 
 #include <climits>
 #include <cstdint>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <type_traits>
@@ -38,6 +40,15 @@ namespace upcxx {
        bit_or           = GEX_OP_OR,    fetch_bit_or     = GEX_OP_FOR,
        bit_xor          = GEX_OP_XOR,   fetch_bit_xor    = GEX_OP_FXOR,
   };
+
+  // How an atomic_domain reaches targets on the caller's node.
+  //   network: every operation goes through GASNet's atomic domain (default).
+  //   native_local: opt-in. If every member of the domain's team shares this
+  //     node, or the conduit's GASNet atomics are themselves performed by the
+  //     target CPU, operations on local_team() targets are done inline with
+  //     CPU atomics on the shared-memory address and complete synchronously.
+  //     Otherwise the domain behaves exactly like `network`.
+  enum class atomic_domain_mode { network, native_local };
   
   namespace detail {
 
@@ -95,6 +106,31 @@ namespace upcxx {
         gex_Flags_t flags
       );
 
+      // Perform the operation with CPU atomics on a locally addressable
+      // `addr`, returning the fetched (or prior) value.
+      static proxy_type inject_local(void *addr, atomic_op opcode,
+        proxy_type val1, proxy_type val2, std::memory_order order
+      );
+
+      // One element of a batched operation. `result` is only used by
+      // fetching operations.
+      struct batch_elt {
+        intrank_t jobrank;
+        void *raw_ptr;
+        proxy_type val;
+        proxy_type *result;
+      };
+
+      // Issue `opcode` on every element inside a single gasnet NBI access
+      // region, returning the region's event. Elements are reordered by target
+      // rank and address first, and with `combine` all elements naming the
+      // same address are folded into one before injection. With
+      // `native_local`, elements on local_team() peers are applied inline.
+      static gex_Event_t inject_batch(std::uintptr_t ad, atomic_op opcode,
+        batch_elt *elts, std::size_t n, bool combine, bool native_local,
+        std::memory_order order, gex_Flags_t flags
+      );
+
       // Our encoding:
       // atomic_gex_ops == ad_gex_handle == 0: 
       //   an invalid (destroyed) object. 
@@ -110,23 +146,66 @@ namespace upcxx {
       std::uintptr_t ad_gex_handle = 0;
 
       const team *parent_tm_;
+
+      // Whether atomic_domain_mode::native_local was requested and is usable.
+      bool native_local_ = false;
       
       // default constructor doesn't do anything besides initializing both:
       //   atomic_gex_ops = 0, ad_gex_handle = 0
       atomic_domain_untyped() {}
 
       // The constructor takes a vector of operations. Currently, flags is currently unsupported.
-      atomic_domain_untyped(std::vector<atomic_op> const &ops, const team &tm);
+      atomic_domain_untyped(std::vector<atomic_op> const &ops, const team &tm,
+                            atomic_domain_mode mode = atomic_domain_mode::network);
       
       ~atomic_domain_untyped();
 
       void destroy(entry_barrier eb);
     };
 
+    // Types GASNet has no atomics for, but which are small and trivially
+    // copyable, are served by the AM-based atomic_domain<T,true> below.
+    template<typename T>
+    struct atomic_via_am: std::integral_constant<bool,
+        !((std::is_integral<T>::value || std::is_floating_point<T>::value) &&
+          (sizeof(T) == 4 || sizeof(T) == 8)) &&
+        std::is_trivially_copyable<T>::value &&
+        !std::is_const<T>::value &&
+        sizeof(T) <= 64
+      > {};
+
+    // Operands of an AM-based atomic as raw bytes, so operations without
+    // operands need not construct a T.
+    template<typename T>
+    struct atomic_am_operands {
+      unsigned char val1[sizeof(T)], val2[sizeof(T)];
+    };
+
+    // The read-modify-write of an AM-based atomic, performed by the owning
+    // rank's master persona. Returns the prior value.
+    template<typename T>
+    T atomic_am_apply(atomic_op aop, T *p, atomic_am_operands<T> const &args) {
+      T prior(*p);
+      switch(aop) {
+      case atomic_op::store:
+        std::memcpy(p, args.val1, sizeof(T));
+        break;
+      case atomic_op::compare_exchange:
+        if(0 == std::memcmp(&prior, args.val1, sizeof(T)))
+          std::memcpy(p, args.val2, sizeof(T));
+        break;
+      default: // load
+        break;
+      }
+      return prior;
+    }
   } // namespace detail 
+
+  template<typename T, bool via_am = detail::atomic_via_am<T>::value>
+  class atomic_domain;
   
   // Atomic domain for any supported type.
-  template<typename T>
+  template<typename T, bool via_am>
   class atomic_domain : 
     private detail::atomic_domain_untyped<sizeof(T), detail::bit_flavor<T>()> {
  
@@ -140,7 +219,8 @@ namespace upcxx {
         (sizeof(T) == 4 || sizeof(T) == 8);
       
       static_assert(is_atomic,
-          "Atomic domains only supported on non-const 32 and 64-bit integral or floating-point types");
+          "Atomic domains only supported on non-const 32 and 64-bit integral or floating-point types, "
+          "or non-const trivially copyable types of at most 64 bytes");
 
       // event values for non-fetching operations
       struct nofetch_aop_event_values {
@@ -158,6 +238,8 @@ namespace upcxx {
       // Must be declared final for the 'delete this' call.
       template<typename CxStateHere>
       struct nofetch_op_cb final: backend::gasnet::handle_cb {
+        UPCXX_OPNEW_POOLED(nofetch_op_cb)
+
         CxStateHere state_here;
 
         nofetch_op_cb(CxStateHere state_here) : state_here{std::move(state_here)} {}
@@ -172,6 +254,8 @@ namespace upcxx {
       // The class that handles the gasnet event. For fetching ops.
       template<typename CxStateHere>
       struct fetch_op_cb final: backend::gasnet::handle_cb {
+        UPCXX_OPNEW_POOLED(fetch_op_cb)
+
         CxStateHere state_here;
         T result;
 
@@ -225,6 +309,18 @@ namespace upcxx {
         // we only have local completion, not remote
         using cxs_here_t = detail::completions_state<detail::event_is_here,
             fetch_aop_event_values, CxsDecayed>;
+
+        if (this->native_local_ && backend::rank_is_local(gptr.rank_)) {
+          cxs_here_t state_here{std::forward<Cxs>(cxs)};
+          auto returner = detail::completions_returner<detail::event_is_here,
+              fetch_aop_event_values, CxsDecayed>{state_here};
+          T result = static_cast<T>(this->inject_local(
+            backend::localize_memory_nonnull(gptr.rank_, reinterpret_cast<std::uintptr_t>(gptr.raw_ptr_)),
+            aop, static_cast<proxy_type>(val1), static_cast<proxy_type>(val2), order
+          ));
+          state_here.template operator()<operation_cx_event>(std::move(result));
+          return returner();
+        }
         
         // Create the callback object
         auto *cb = new fetch_op_cb<cxs_here_t>{cxs_here_t{std::forward<Cxs>(cxs)}};
@@ -241,11 +337,11 @@ namespace upcxx {
         
         if (h != GEX_EVENT_INVALID) { // asynchronous AMO in-flight
           cb->handle = reinterpret_cast<uintptr_t>(h);
-          backend::gasnet::register_cb(cb);
+          backend::gasnet::register_cb(cb, backend::gasnet::handle_cb_class::amo);
           backend::gasnet::after_gasnet();
         } else { // gasnet completed AMO synchronously
           UPCXX_ASSERT(cb->handle == 0);
-          backend::gasnet::get_handle_cb_queue().execute_outside(cb);
+          backend::gasnet::get_handle_cb_queue().execute_outside(cb, backend::gasnet::handle_cb_class::amo);
         }
         
         return returner();
@@ -289,6 +385,15 @@ namespace upcxx {
         
         auto returner = detail::completions_returner<detail::event_is_here,
             nofetch_aop_event_values, CxsDecayed>{cb.state_here};
+
+        if (this->native_local_ && backend::rank_is_local(gptr.rank_)) {
+          this->inject_local(
+            backend::localize_memory_nonnull(gptr.rank_, reinterpret_cast<std::uintptr_t>(gptr.raw_ptr_)),
+            aop, static_cast<proxy_type>(val1), static_cast<proxy_type>(val2), order
+          );
+          cb.state_here.template operator()<operation_cx_event>();
+          return returner();
+        }
         
         // execute the backend gasnet function
         gex_Event_t h = this->inject( this->ad_gex_handle,
@@ -300,7 +405,7 @@ namespace upcxx {
         if (h != GEX_EVENT_INVALID) { // asynchronous AMO in-flight
           cb.handle = reinterpret_cast<uintptr_t>(h);
           // move callback to heap since it lives asynchronously
-          backend::gasnet::register_cb(new decltype(cb)(std::move(cb)));
+          backend::gasnet::register_cb(new decltype(cb)(std::move(cb)), backend::gasnet::handle_cb_class::amo);
           backend::gasnet::after_gasnet();
         } else { // gasnet completed AMO synchronously
           UPCXX_ASSERT(cb.handle == 0);
@@ -311,6 +416,68 @@ namespace upcxx {
         return returner();
       }
 
+      // generic batched atomic operation, fetching iff `results` is non-null
+      template<typename PairIter, typename Cxs>
+      NOFETCH_RTYPE<Cxs> batch(atomic_op aop, PairIter begin, PairIter end, T *results,
+                               std::memory_order order, bool combine, Cxs &&cxs) const {
+        using CxsDecayed = typename std::decay<Cxs>::type;
+        using untyped = detail::atomic_domain_untyped<sizeof(T), detail::bit_flavor<T>()>;
+        UPCXX_ASSERT_INIT();
+        UPCXX_ASSERT(this->atomic_gex_ops || this->ad_gex_handle, "Atomic domain is not constructed");
+        UPCXX_ASSERT(static_cast<gex_OP_t>(aop) & this->atomic_gex_ops,
+              "Atomic operation '" << detail::atomic_op_str(aop) << "'"
+              " not in domain's operation set '" << 
+              detail::opset_to_string(this->atomic_gex_ops) << "'\n");
+        UPCXX_ASSERT_ALWAYS(
+          (detail::completions_has_event<CxsDecayed, operation_cx_event>::value),
+          "Not requesting operation completion for batched '" <<
+          detail::atomic_op_str(aop) << "' is surely an error."
+        );
+        UPCXX_ASSERT_ALWAYS(
+          (!detail::completions_has_event<CxsDecayed, source_cx_event>::value &&
+           !detail::completions_has_event<CxsDecayed, remote_cx_event>::value),
+          "Atomic operation '" << detail::atomic_op_str(aop) << "'"
+          " does not support source or remote completion."
+        );
+
+        std::vector<typename untyped::batch_elt> elts;
+        for(PairIter it = begin; it != end; ++it) {
+          global_ptr<T> gptr = (*it).first;
+          UPCXX_GPTR_CHK(gptr);
+          UPCXX_ASSERT(gptr != nullptr, "Global pointer for atomic operation is null");
+          UPCXX_ASSERT(this->parent_tm_->from_world(gptr.rank_,-1) >= 0, 
+                       "Global pointer must reference a member of the team used to construct atomic_domain");
+          elts.push_back({
+            gptr.rank_, gptr.raw_ptr_, static_cast<proxy_type>((*it).second),
+            results ? reinterpret_cast<proxy_type*>(results + elts.size()) : nullptr
+          });
+        }
+
+        using cxs_here_t = detail::completions_state<detail::event_is_here,
+            nofetch_aop_event_values, CxsDecayed>;
+        
+        auto *cb = new nofetch_op_cb<cxs_here_t>{cxs_here_t{std::forward<Cxs>(cxs)}};
+        
+        auto returner = detail::completions_returner<detail::event_is_here,
+            nofetch_aop_event_values, CxsDecayed>{cb->state_here};
+
+        gex_Event_t h = untyped::inject_batch(this->ad_gex_handle,
+          aop, elts.data(), elts.size(), combine, this->native_local_, order,
+          detail::memory_order_flags(order) | GEX_FLAG_RANK_IS_JOBRANK
+        );
+
+        if (h != GEX_EVENT_INVALID) { // asynchronous AMOs in-flight
+          cb->handle = reinterpret_cast<uintptr_t>(h);
+          backend::gasnet::register_cb(cb, backend::gasnet::handle_cb_class::amo);
+          backend::gasnet::after_gasnet();
+        } else { // empty batch, or gasnet completed every AMO synchronously
+          UPCXX_ASSERT(cb->handle == 0);
+          backend::gasnet::get_handle_cb_queue().execute_outside(cb, backend::gasnet::handle_cb_class::amo);
+        }
+        
+        return returner();
+      }
+
     public:
       // default constructor 
       // issue #316: this is NOT guaranteed by spec
@@ -324,6 +491,7 @@ namespace upcxx {
         this->ad_gex_handle = that.ad_gex_handle;
         this->atomic_gex_ops = that.atomic_gex_ops;
         this->parent_tm_ = that.parent_tm_;
+        this->native_local_ = that.native_local_;
         // revert `that` to non-constructed state
         that.atomic_gex_ops = 0;
         that.ad_gex_handle = 0;
@@ -338,6 +506,7 @@ namespace upcxx {
         this->ad_gex_handle = that.ad_gex_handle;
         this->atomic_gex_ops = that.atomic_gex_ops;
         this->parent_tm_ = that.parent_tm_;
+        this->native_local_ = that.native_local_;
         // revert `that` to non-constructed state
         that.atomic_gex_ops = 0;
         that.ad_gex_handle = 0;
@@ -347,9 +516,18 @@ namespace upcxx {
       #endif
       
       // The constructor takes a vector of operations. Currently, flags is currently unsupported.
-      atomic_domain(std::vector<atomic_op> const &ops, const team &tm = upcxx::world()) :
+      // `mode` must be the same on every member of `tm`.
+      atomic_domain(std::vector<atomic_op> const &ops, const team &tm = upcxx::world(),
+                    atomic_domain_mode mode = atomic_domain_mode::network) :
         detail::atomic_domain_untyped<sizeof(T), 
-           detail::bit_flavor<T>()>((UPCXX_ASSERT_INIT(),UPCXX_ASSERT_COLLECTIVE_SAFE(entry_barrier::user),ops), tm) {}
+           detail::bit_flavor<T>()>((UPCXX_ASSERT_INIT(),UPCXX_ASSERT_COLLECTIVE_SAFE(entry_barrier::user),ops), tm, mode) {}
+
+      // Whether operations on local_team() targets bypass GASNet, which is
+      // only the case if atomic_domain_mode::native_local was requested and
+      // could be honored.
+      bool is_native_local() const {
+        return this->native_local_;
+      }
       
       void destroy(entry_barrier eb = entry_barrier::user) {
         UPCXX_ASSERT_INIT();
@@ -404,6 +582,46 @@ namespace upcxx {
         return fop(atomic_op::compare_exchange, gptr, order, val1, val2, std::forward<Cxs>(cxs));
       }
       
+      // Batched operations: apply `aop` to every element of [begin, end), a
+      // sequence of `std::pair<global_ptr<T>, T>` (the operand is ignored by
+      // operations which take none), with a single operation completion for
+      // the whole batch. Elements are issued grouped by target rank and in no
+      // particular order, so two elements naming the same location are
+      // concurrent atomics. May not be called inside an nbi_begin()/nbi_end()
+      // region.
+      template<typename PairIter, typename Cxs = FUTURE_CX>
+      UPCXX_NODISCARD
+      NOFETCH_RTYPE<Cxs> op_batch(atomic_op aop, PairIter begin, PairIter end,
+                                  std::memory_order order, Cxs &&cxs = Cxs{{}}) const {
+        UPCXX_ASSERT_INIT();
+        return batch(aop, begin, end, (T*)nullptr, order, /*combine=*/false, std::forward<Cxs>(cxs));
+      }
+
+      // As op_batch(), but elements naming the same location are first folded
+      // locally into a single operation (eg operands summed for add and sub),
+      // so each distinct location sees one network atomic. Only for add, sub,
+      // mul, min, max and the bitwise operations. For floating-point types
+      // the folding reassociates, so results may differ in the last bits.
+      template<typename PairIter, typename Cxs = FUTURE_CX>
+      UPCXX_NODISCARD
+      NOFETCH_RTYPE<Cxs> op_batch_combined(atomic_op aop, PairIter begin, PairIter end,
+                                           std::memory_order order, Cxs &&cxs = Cxs{{}}) const {
+        UPCXX_ASSERT_INIT();
+        return batch(aop, begin, end, (T*)nullptr, order, /*combine=*/true, std::forward<Cxs>(cxs));
+      }
+
+      // Fetching form of op_batch(): the value fetched by the i'th element is
+      // written to `results[i]`, which must remain valid until operation
+      // completion. compare_exchange is not supported.
+      template<typename PairIter, typename Cxs = FUTURE_CX>
+      UPCXX_NODISCARD
+      NOFETCH_RTYPE<Cxs> fetch_op_batch(atomic_op aop, PairIter begin, PairIter end, T *results,
+                                        std::memory_order order, Cxs &&cxs = Cxs{{}}) const {
+        UPCXX_ASSERT_INIT();
+        UPCXX_ASSERT(results != nullptr || begin == end, "fetch_op_batch: results may not be null");
+        return batch(aop, begin, end, results, order, /*combine=*/false, std::forward<Cxs>(cxs));
+      }
+      
       #define UPCXX_AD_METHODS(name, constraint)\
         template<typename Cxs = FUTURE_CX>\
         UPCXX_NODISCARD \
@@ -436,6 +654,185 @@ namespace upcxx {
       #undef UPCXX_AD_INTONLY
       #undef UPCXX_AD_ANYTYPE
   };
+
+  // Atomic domain for a small trivially copyable type GASNet can not operate
+  // on, like a 16-byte (pointer, tag) pair. Each operation is shipped as an
+  // AM to the rank owning the location, whose master persona performs it
+  // during internal progress, so every access to the location must go
+  // through this domain. Operations the caller can perform on its own
+  // location while holding the master persona complete synchronously. Only
+  // load, store and compare_exchange are supported, and values compare by
+  // object representation, as with std::atomic.
+  template<typename T>
+  class atomic_domain<T, /*via_am=*/true> {
+    private:
+      gex_OP_t atomic_gex_ops = 0;
+      const team *parent_tm_ = nullptr;
+
+      struct nofetch_aop_event_values {
+        template<typename Event>
+        using tuple_t = std::tuple<>;
+      };
+      struct fetch_aop_event_values {
+        template<typename Event>
+        using tuple_t = typename std::conditional<
+            std::is_same<Event, operation_cx_event>::value, std::tuple<T>, std::tuple<> >::type;
+      };
+
+      template<typename Cxs>
+      using FETCH_RTYPE = typename detail::completions_returner<detail::event_is_here,
+          fetch_aop_event_values, typename std::decay<Cxs>::type>::return_t;
+      template<typename Cxs>
+      using NOFETCH_RTYPE = typename detail::completions_returner<detail::event_is_here,
+          nofetch_aop_event_values, typename std::decay<Cxs>::type>::return_t;
+      using FUTURE_CX = completions<future_cx<operation_cx_event> >;
+
+      // Signal operation completion with or without the fetched value.
+      template<typename State>
+      static void fire(State &state, T &&, std::false_type/*fetching*/) {
+        state.template operator()<operation_cx_event>();
+      }
+      template<typename State>
+      static void fire(State &state, T &&prior, std::true_type/*fetching*/) {
+        state.template operator()<operation_cx_event>(std::move(prior));
+      }
+      template<typename Lpc>
+      static void reply(intrank_t initiator, Lpc *lpc, T &&, std::false_type/*fetching*/) {
+        backend::template send_awaken_lpc(initiator, lpc, std::tuple<>());
+      }
+      template<typename Lpc>
+      static void reply(intrank_t initiator, Lpc *lpc, T &&prior, std::true_type/*fetching*/) {
+        backend::template send_awaken_lpc(initiator, lpc, std::tuple<T&&>(std::move(prior)));
+      }
+
+      template<typename EventValues, typename Cxs>
+      typename detail::completions_returner<detail::event_is_here,
+          EventValues, typename std::decay<Cxs>::type>::return_t
+      am_op(atomic_op aop, global_ptr<T> gptr, T const *val1, T const *val2, Cxs &&cxs) const {
+        using CxsDecayed = typename std::decay<Cxs>::type;
+        using fetching = std::integral_constant<bool,
+            std::is_same<EventValues, fetch_aop_event_values>::value>;
+        UPCXX_ASSERT_INIT();
+        UPCXX_ASSERT(parent_tm_ != nullptr, "Atomic domain is not constructed");
+        UPCXX_GPTR_CHK(gptr);
+        UPCXX_ASSERT(gptr != nullptr, "Global pointer for atomic operation is null");
+        UPCXX_ASSERT(parent_tm_->from_world(gptr.rank_,-1) >= 0, 
+                     "Global pointer must reference a member of the team used to construct atomic_domain");
+        UPCXX_ASSERT(static_cast<gex_OP_t>(aop) & atomic_gex_ops,
+              "Atomic operation '" << detail::atomic_op_str(aop) << "'"
+              " not in domain's operation set '" << 
+              detail::opset_to_string(atomic_gex_ops) << "'\n");
+        UPCXX_ASSERT_ALWAYS(
+          (detail::completions_has_event<CxsDecayed, operation_cx_event>::value),
+          "Not requesting operation completion for '" <<
+          detail::atomic_op_str(aop) << "' is surely an error."
+        );
+        UPCXX_ASSERT_ALWAYS(
+          (!detail::completions_has_event<CxsDecayed, source_cx_event>::value &&
+           !detail::completions_has_event<CxsDecayed, remote_cx_event>::value),
+          "Atomic operation '" << detail::atomic_op_str(aop) << "'"
+          " does not support source or remote completion."
+        );
+
+        using cxs_state_t = detail::completions_state<detail::event_is_here,
+            EventValues, CxsDecayed>;
+
+        cxs_state_t state(std::forward<Cxs>(cxs));
+        auto returner = detail::completions_returner<detail::event_is_here,
+            EventValues, CxsDecayed>(state);
+
+        T *raw = gptr.raw_ptr_;
+        detail::atomic_am_operands<T> args;
+        if(val1) std::memcpy(args.val1, val1, sizeof(T));
+        if(val2) std::memcpy(args.val2, val2, sizeof(T));
+
+        if(gptr.rank_ == backend::rank_me && backend::master.active_with_caller()) {
+          // we are the owner's master persona, nobody can interleave with us
+          fire(state, detail::atomic_am_apply(aop, raw, args), fetching());
+          return returner();
+        }
+
+        intrank_t initiator = backend::rank_me;
+        auto *op_lpc = static_cast<cxs_state_t&&>(state).template to_lpc_dormant<operation_cx_event>();
+
+        backend::template send_am_master<progress_level::internal>(gptr.rank_,
+          [=]() {
+            reply(initiator, op_lpc, detail::atomic_am_apply(aop, raw, args), fetching());
+          }
+        );
+
+        return returner();
+      }
+
+    public:
+      atomic_domain(atomic_domain &&that) {
+        UPCXX_ASSERT_MASTER();
+        this->atomic_gex_ops = that.atomic_gex_ops;
+        this->parent_tm_ = that.parent_tm_;
+        that.atomic_gex_ops = 0;
+        that.parent_tm_ = nullptr;
+      }
+
+      // The constructor takes a vector of operations, which may only include
+      // load, store and compare_exchange. `mode` has no effect: targets on
+      // this node are served by their owner like any other.
+      atomic_domain(std::vector<atomic_op> const &ops, const team &tm = upcxx::world(),
+                    atomic_domain_mode mode = atomic_domain_mode::network) {
+        UPCXX_ASSERT_INIT();
+        UPCXX_ASSERT_COLLECTIVE_SAFE(entry_barrier::user);
+        UPCXX_ASSERT_MASTER();
+        for(atomic_op op: ops) {
+          UPCXX_ASSERT_ALWAYS(
+            op == atomic_op::load || op == atomic_op::store || op == atomic_op::compare_exchange,
+            "atomic_domain on a non-arithmetic type may not use '" << detail::atomic_op_str(op) << "'"
+          );
+          atomic_gex_ops |= static_cast<gex_OP_t>(op);
+        }
+        parent_tm_ = &tm;
+      }
+
+      void destroy(entry_barrier eb = entry_barrier::user) {
+        UPCXX_ASSERT_INIT();
+        UPCXX_ASSERT_COLLECTIVE_SAFE(eb);
+        UPCXX_ASSERT_MASTER();
+        UPCXX_ASSERT(parent_tm_, "attempted to destroy() and atomic_domain which was not constructed");
+        backend::quiesce(*parent_tm_, eb);
+        atomic_gex_ops = 0;
+        parent_tm_ = nullptr;
+      }
+
+      ~atomic_domain() {
+        if(backend::init_count > 0) { // we don't assert on leaks after finalization
+          UPCXX_ASSERT_ALWAYS(
+            parent_tm_ == nullptr,
+            "ERROR: `upcxx::atomic_domain::destroy()` must be called collectively before destructor."
+          );
+        }
+      }
+
+      bool is_native_local() const {
+        return false;
+      }
+
+      template<typename Cxs = FUTURE_CX>
+      UPCXX_NODISCARD
+      NOFETCH_RTYPE<Cxs> store(global_ptr<T> gptr, T val, std::memory_order order,
+                               Cxs &&cxs = Cxs{{}}) const {
+        return am_op<nofetch_aop_event_values>(atomic_op::store, gptr, &val, nullptr, std::forward<Cxs>(cxs));
+      }
+      template<typename Cxs = FUTURE_CX>
+      UPCXX_NODISCARD
+      FETCH_RTYPE<Cxs> load(global_ptr<const T> gptr, std::memory_order order, Cxs &&cxs = Cxs{{}}) const {
+        return am_op<fetch_aop_event_values>(atomic_op::load, const_pointer_cast<T>(gptr),
+                                             nullptr, nullptr, std::forward<Cxs>(cxs));
+      }
+      template<typename Cxs = FUTURE_CX>
+      UPCXX_NODISCARD
+      FETCH_RTYPE<Cxs> compare_exchange(global_ptr<T> gptr, T val1, T val2, std::memory_order order,
+                                        Cxs &&cxs = Cxs{{}}) const {
+        return am_op<fetch_aop_event_values>(atomic_op::compare_exchange, gptr, &val1, &val2, std::forward<Cxs>(cxs));
+      }
+  };
 } // namespace upcxx
 
 #endif
@@ -8,6 +8,7 @@
 #include <upcxx/memory_kind.hpp>
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <tuple>
 
@@ -66,6 +67,12 @@ namespace backend {
   extern std::unique_ptr<std::uintptr_t[/*local_team.size()*/]> pshm_vbase;
   extern std::unique_ptr<std::uintptr_t[/*local_team.size()*/]> pshm_size;
 
+  // Copies of at least this many bytes done by local_copy() use non-temporal
+  // stores. Set by UPCXX_LOCAL_COPY_NT_MIN.
+  extern std::size_t local_copy_nt_min;
+
+  void local_copy_nt(void *buf_d, void const *buf_s, std::size_t size);
+
   //////////////////////////////////////////////////////////////////////////////
   
   template<typename Fn>
@@ -225,6 +232,17 @@ namespace backend {
     return raw;
   }
 
+  // Copy between buffers directly addressable by this process, typically a
+  // private buffer and an on-node peer's segment as mapped by
+  // localize_memory(). Large copies stream past the cache since the data is
+  // usually bound for another core.
+  inline void local_copy(void *buf_d, void const *buf_s, std::size_t size) {
+    if(size < local_copy_nt_min)
+      std::memcpy(buf_d, buf_s, size);
+    else
+      local_copy_nt(buf_d, buf_s, size);
+  }
+
   void validate_global_ptr(bool allow_null, intrank_t rank, void *raw_ptr, std::int32_t heap_idx,
                            memory_kind KindSet, size_t T_align, const char *T_name, 
                            const char *short_context, const char *context);
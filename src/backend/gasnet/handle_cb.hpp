@@ -9,10 +9,25 @@ namespace upcxx {
 namespace backend {
 namespace gasnet {
   struct handle_cb;
+  struct handle_cb_list;
   struct handle_cb_queue;
 
+  // Classes of operation whose handles are queued (and polled) separately.
+  // Handles of one class tend to retire in injection order relative to each
+  // other but not relative to other classes (an rget may retire long before
+  // a large rput issued ahead of it), so interleaving them in one queue would
+  // defeat the in-order polling heuristic of burst().
+  enum class handle_cb_class: int {
+    misc = 0,
+    rma_put,
+    rma_get,
+    amo,
+    coll,
+    n_
+  };
+
   struct handle_cb_successor {
-    handle_cb_queue *q_;
+    handle_cb_list *q_;
     handle_cb **pp_;
     void operator()(handle_cb *succ);
   };
@@ -40,11 +55,19 @@ namespace gasnet {
   }
   
   
-  // This type is contained within `__thread` storage, so it must be:
-  //   1. trivially destructible.
-  //   2. constexpr constructible equivalent to zero-initialization.
-  struct handle_cb_queue {
+  // Polling tallies of one handle_cb_list, accumulated for the lifetime of
+  // the queue.
+  struct handle_cb_poll_stats {
+    std::uint64_t tests; // handles tested
+    std::uint64_t misses; // tests which found the handle not ready
+    std::uint64_t bursts; // burst()'s which tested at least one handle
+  };
+  
+  // A FIFO of handle_cb's all of the same handle_cb_class. Same storage
+  // requirements as handle_cb_queue.
+  struct handle_cb_list {
     friend struct handle_cb_successor;
+    friend struct handle_cb_queue;
     
     handle_cb *head_;
     //handle_cb **tailp_;
@@ -53,6 +76,8 @@ namespace gasnet {
     // Tracks number of consecutive burst()'s that were fruitless and aborted
     // due to too many handle test failures ("misses").
     int aborted_burst_n_;
+
+    handle_cb_poll_stats stats_;
     
   private:
     handle_cb** get_tailp() const {
@@ -66,39 +91,73 @@ namespace gasnet {
     }
     
   public:
-    constexpr handle_cb_queue():
+    constexpr handle_cb_list():
       head_(),
       tailp_xor_head_(),
-      aborted_burst_n_() {
+      aborted_burst_n_(),
+      stats_() {
+    }
+    handle_cb_list(handle_cb_list const&) = delete;
+    
+    bool empty() const {
+      return this->head_ == nullptr;
+    }
+    
+    void enqueue(handle_cb *cb);
+    
+    int burst(bool spinning); // defined in runtime.cpp
+  };
+  
+  // This type is contained within `__thread` storage, so it must be:
+  //   1. trivially destructible.
+  //   2. constexpr constructible equivalent to zero-initialization.
+  struct handle_cb_queue {
+    handle_cb_list lists_[int(handle_cb_class::n_)];
+    
+    constexpr handle_cb_queue():
+      lists_() {
     }
     handle_cb_queue(handle_cb_queue const&) = delete;
     
     bool empty() const;
     
-    void enqueue(handle_cb *cb);
+    void enqueue(handle_cb *cb, handle_cb_class cls = handle_cb_class::misc);
     
     template<typename Cb>
-    void execute_outside(Cb *cb);
+    void execute_outside(Cb *cb, handle_cb_class cls = handle_cb_class::misc);
     
     int burst(bool spinning); // defined in runtime.cpp
+
+    handle_cb_poll_stats const& poll_stats(handle_cb_class cls) const {
+      return this->lists_[int(cls)].stats_;
+    }
   };
   
   //////////////////////////////////////////////////////////////////////////////
 
-  inline bool handle_cb_queue::empty() const {
-    return this->head_ == nullptr;
-  }
-  
-  inline void handle_cb_queue::enqueue(handle_cb *cb) {
+  inline void handle_cb_list::enqueue(handle_cb *cb) {
     UPCXX_ASSERT(cb->next_ == reinterpret_cast<handle_cb*>(0x1));
     cb->next_ = nullptr;
     *this->get_tailp() = cb;
     this->set_tailp(&cb->next_);
   }
+
+  inline bool handle_cb_queue::empty() const {
+    for(handle_cb_list const &l: this->lists_) {
+      if(!l.empty())
+        return false;
+    }
+    return true;
+  }
+  
+  inline void handle_cb_queue::enqueue(handle_cb *cb, handle_cb_class cls) {
+    this->lists_[int(cls)].enqueue(cb);
+  }
   
   template<typename Cb>
-  void handle_cb_queue::execute_outside(Cb *cb) {
-    cb->execute_and_delete(handle_cb_successor{this, this->get_tailp()});
+  void handle_cb_queue::execute_outside(Cb *cb, handle_cb_class cls) {
+    handle_cb_list *l = &this->lists_[int(cls)];
+    cb->execute_and_delete(handle_cb_successor{l, l->get_tailp()});
   }
   
   inline void handle_cb_successor::operator()(handle_cb *succ) {
@@ -0,0 +1,484 @@
+#include <upcxx/backend/gasnet/runtime.hpp>
+#include <upcxx/backend/gasnet/runtime_internal.hpp>
+#include <upcxx/backend/gasnet/noise_log.hpp>
+
+#include <upcxx/os_env.hpp>
+#include <upcxx/team.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <type_traits>
+
+/* Node-aware collectives over the world team.
+ *
+ * Ranks sharing a node (the local_team) meet in a control block which the
+ * node's leader (local rank 0) allocates in its shared segment and every peer
+ * reaches through the PSHM mapping. A collective runs in three phases: peers
+ * check in with the leader through per-peer flags and contribution slots, the
+ * leaders run the flat GEX collective among themselves over a team holding
+ * one rank per node, then each leader publishes the result and a release flag
+ * which its peers pick up. The network only ever sees one rank per node.
+ *
+ * Every collective takes the next generation number. A peer raises its
+ * arrive flag to the generation once its input is in place, and the leader
+ * raises the release flag once the output is. The leader waits for every
+ * arrival before releasing, so seeing release `g` means every peer has
+ * finished `g-1`. That lets broadcast data alternate between two buffers by
+ * generation parity, and contribution slots need only one each.
+ *
+ * Only payloads which fit a slot are handled here, larger ones are bandwidth
+ * bound and go to GEX directly, as do collectives over any other team.
+ */
+
+using namespace upcxx;
+using namespace std;
+
+namespace gasnet = upcxx::backend::gasnet;
+
+using upcxx::backend::gasnet::noise_log;
+
+bool gasnet::node_coll_enabled = false;
+
+namespace {
+  struct alignas(64) node_flag {
+    std::atomic<std::uint64_t> gen;
+  };
+
+  gex_TM_t leader_tm = GEX_TM_INVALID; // one rank per node, leaders only
+  void *leader_scratch = nullptr;
+
+  char *block = nullptr; // control block, local address
+  std::size_t block_size;
+  std::size_t slot_size;
+
+  intrank_t peer_n, peer_me;
+  intrank_t node_n, node_me;
+
+  std::uint64_t gen_next = 1;
+
+  node_flag* release_flag() {
+    return reinterpret_cast<node_flag*>(block);
+  }
+  node_flag* arrive_flag(intrank_t peer) {
+    return reinterpret_cast<node_flag*>(block) + 1 + peer;
+  }
+  char* data_buf(std::uint64_t gen) {
+    return block + (1 + peer_n)*sizeof(node_flag) + (gen & 1)*slot_size;
+  }
+  char* contrib_buf(intrank_t peer) {
+    return block + (1 + peer_n)*sizeof(node_flag) + (2 + peer)*slot_size;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Local combining for the leader's fan-in, mirrors GEX's builtin ops
+
+  template<typename T>
+  void combine_typed(gex_OP_t op, T const *in, T *acc, std::size_t n, std::false_type integral) {
+    switch(op) {
+    case GEX_OP_ADD:
+      for(std::size_t i=0; i != n; i++) acc[i] += in[i];
+      break;
+    case GEX_OP_MULT:
+      for(std::size_t i=0; i != n; i++) acc[i] *= in[i];
+      break;
+    case GEX_OP_MIN:
+      for(std::size_t i=0; i != n; i++) acc[i] = in[i] < acc[i] ? in[i] : acc[i];
+      break;
+    case GEX_OP_MAX:
+      for(std::size_t i=0; i != n; i++) acc[i] = acc[i] < in[i] ? in[i] : acc[i];
+      break;
+    default:
+      UPCXX_ASSERT_ALWAYS(false, "Unexpected GEX reduction op "<<op);
+    }
+  }
+
+  template<typename T>
+  void combine_typed(gex_OP_t op, T const *in, T *acc, std::size_t n, std::true_type integral) {
+    switch(op) {
+    case GEX_OP_AND:
+      for(std::size_t i=0; i != n; i++) acc[i] &= in[i];
+      break;
+    case GEX_OP_OR:
+      for(std::size_t i=0; i != n; i++) acc[i] |= in[i];
+      break;
+    case GEX_OP_XOR:
+      for(std::size_t i=0; i != n; i++) acc[i] ^= in[i];
+      break;
+    default:
+      combine_typed(op, in, acc, n, std::false_type());
+    }
+  }
+
+  template<typename T>
+  void combine_as(gex_OP_t op, void const *in, void *acc, std::size_t n) {
+    combine_typed(op, static_cast<T const*>(in), static_cast<T*>(acc), n, std::is_integral<T>());
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Collective operations, queued in issue order
+
+  struct node_op {
+    std::uint64_t gen;
+    gasnet::handle_cb *cb;
+    int phase = 0;
+    intrank_t arrived_n = 1; // leader: peers known to have arrived, counting self
+    gex_Event_t e = GEX_EVENT_INVALID;
+
+    node_op(gasnet::handle_cb *cb): gen(gen_next++), cb(cb) {}
+    virtual ~node_op() {}
+
+    // Returns true once the operation is finished on this rank.
+    virtual bool advance() = 0;
+
+    void arrive() {
+      arrive_flag(peer_me)->gen.store(gen, std::memory_order_release);
+    }
+    bool released() const {
+      return release_flag()->gen.load(std::memory_order_acquire) >= gen;
+    }
+    void release() {
+      release_flag()->gen.store(gen, std::memory_order_release);
+    }
+    bool all_arrived() {
+      while(arrived_n != peer_n) {
+        if(arrive_flag(arrived_n)->gen.load(std::memory_order_acquire) < gen)
+          return false;
+        arrived_n += 1;
+      }
+      return true;
+    }
+    bool network_done() const {
+      return e == GEX_EVENT_INVALID || 0 == gex_Event_Test(e);
+    }
+  };
+
+  std::deque<node_op*> node_q;
+
+  struct barrier_op final: node_op {
+    using node_op::node_op;
+
+    bool advance() override {
+      if(peer_me != 0) {
+        if(phase == 0) {
+          arrive();
+          phase = 1;
+        }
+        return released();
+      }
+
+      if(phase == 0) {
+        if(!all_arrived())
+          return false;
+        if(leader_tm != GEX_TM_INVALID)
+          e = gex_Coll_BarrierNB(leader_tm, 0);
+        phase = 1;
+      }
+      if(!network_done())
+        return false;
+      release();
+      return true;
+    }
+  };
+
+  struct broadcast_op final: node_op {
+    intrank_t root;
+    void *buf;
+    std::size_t size;
+
+    broadcast_op(gasnet::handle_cb *cb, intrank_t root, void *buf, std::size_t size):
+      node_op(cb), root(root), buf(buf), size(size) {
+    }
+
+    bool advance() override {
+      bool root_here = root/peer_n == node_me;
+      bool root_is_peer = root_here && root%peer_n != 0;
+
+      if(peer_me != 0) {
+        if(phase == 0) {
+          if(root == backend::rank_me)
+            std::memcpy(data_buf(gen), buf, size);
+          arrive();
+          phase = 1;
+        }
+        if(!released())
+          return false;
+        if(root != backend::rank_me)
+          std::memcpy(buf, data_buf(gen), size);
+        return true;
+      }
+
+      if(phase == 0) {
+        if(!all_arrived())
+          return false;
+        if(root_is_peer)
+          std::memcpy(buf, data_buf(gen), size);
+        if(leader_tm != GEX_TM_INVALID)
+          e = gex_Coll_BroadcastNB(leader_tm, root/peer_n, buf, buf, size, 0);
+        phase = 1;
+      }
+      if(!network_done())
+        return false;
+      if(!root_is_peer)
+        std::memcpy(data_buf(gen), buf, size);
+      release();
+      return true;
+    }
+  };
+
+  struct reduce_op final: node_op {
+    intrank_t root_or_all;
+    const void *src;
+    void *dst;
+    std::size_t elt_sz, elt_n;
+    gex_DT_t ty_id;
+    gex_OP_t op_id;
+    gex_Coll_ReduceFn_t op_vecfn;
+    void *op_data;
+    void *acc = nullptr;
+
+    reduce_op(gasnet::handle_cb *cb, intrank_t root_or_all,
+              const void *src, void *dst, std::size_t elt_sz, std::size_t elt_n,
+              gex_DT_t ty_id, gex_OP_t op_id, gex_Coll_ReduceFn_t op_vecfn, void *op_data):
+      node_op(cb), root_or_all(root_or_all), src(src), dst(dst),
+      elt_sz(elt_sz), elt_n(elt_n),
+      ty_id(ty_id), op_id(op_id), op_vecfn(op_vecfn), op_data(op_data) {
+    }
+
+    bool want_result() const {
+      return root_or_all < 0 || root_or_all == backend::rank_me;
+    }
+
+    void combine(void const *in) {
+      if(op_id == GEX_OP_USER) {
+        op_vecfn(in, acc, elt_n, op_data);
+        return;
+      }
+
+      switch(ty_id) {
+      case GEX_DT_I32: combine_as<std::int32_t>(op_id, in, acc, elt_n); break;
+      case GEX_DT_U32: combine_as<std::uint32_t>(op_id, in, acc, elt_n); break;
+      case GEX_DT_I64: combine_as<std::int64_t>(op_id, in, acc, elt_n); break;
+      case GEX_DT_U64: combine_as<std::uint64_t>(op_id, in, acc, elt_n); break;
+      case GEX_DT_FLT: combine_as<float>(op_id, in, acc, elt_n); break;
+      case GEX_DT_DBL: combine_as<double>(op_id, in, acc, elt_n); break;
+      default:
+        UPCXX_ASSERT_ALWAYS(false, "Unexpected GEX reduction type "<<ty_id);
+      }
+    }
+
+    bool advance() override {
+      std::size_t size = elt_sz*elt_n;
+
+      if(peer_me != 0) {
+        if(phase == 0) {
+          std::memcpy(contrib_buf(peer_me), src, size);
+          arrive();
+          phase = 1;
+        }
+        if(!released())
+          return false;
+        if(want_result())
+          std::memcpy(dst, data_buf(gen), size);
+        return true;
+      }
+
+      if(phase == 0) {
+        if(!all_arrived())
+          return false;
+
+        acc = detail::alloc_aligned(size, 64);
+        std::memcpy(acc, src, size);
+        for(intrank_t p=1; p < peer_n; p++)
+          combine(contrib_buf(p));
+
+        if(leader_tm != GEX_TM_INVALID) {
+          e = root_or_all >= 0
+            ? gex_Coll_ReduceToOneNB(
+                leader_tm, root_or_all/peer_n, acc, acc,
+                ty_id, elt_sz, elt_n, op_id, op_vecfn, op_data, 0
+              )
+            : gex_Coll_ReduceToAllNB(
+                leader_tm, acc, acc,
+                ty_id, elt_sz, elt_n, op_id, op_vecfn, op_data, 0
+              );
+        }
+        phase = 1;
+      }
+      if(!network_done())
+        return false;
+
+      if(root_or_all < 0 || root_or_all/peer_n == node_me) {
+        if(want_result())
+          std::memcpy(dst, acc, size);
+        std::memcpy(data_buf(gen), acc, size);
+      }
+      std::free(acc);
+      release();
+      return true;
+    }
+  };
+
+  void node_enqueue(node_op *op) {
+    node_q.push_back(op);
+    gasnet::node_coll_poll();
+    gasnet::after_gasnet();
+  }
+
+  bool node_eligible(const team &tm, std::size_t size) {
+    return gasnet::node_coll_enabled &&
+           gasnet::handle_of(tm) == gasnet::handle_of(upcxx::world()) &&
+           size <= slot_size;
+  }
+}
+
+void gasnet::node_coll_poll() {
+  while(!node_q.empty() && node_q.front()->advance()) {
+    node_op *op = node_q.front();
+    node_q.pop_front();
+
+    // Hand the finished operation to the completion queue as an already
+    // satisfied handle so it completes like its flat GEX counterpart.
+    op->cb->handle = reinterpret_cast<uintptr_t>(GEX_EVENT_INVALID);
+    {
+      detail::persona_scope_redundant master_on_top(backend::master, detail::the_persona_tls);
+      gasnet::register_cb(op->cb, gasnet::handle_cb_class::coll);
+    }
+    delete op;
+  }
+}
+
+bool gasnet::node_coll_barrier(const team &tm, handle_cb *cb) {
+  if(!node_eligible(tm, 0))
+    return false;
+
+  node_enqueue(new barrier_op(cb));
+  return true;
+}
+
+bool gasnet::node_coll_broadcast(
+    const team &tm, intrank_t root, void *buf, std::size_t size,
+    handle_cb *cb
+  ) {
+  if(!node_eligible(tm, size))
+    return false;
+
+  node_enqueue(new broadcast_op(cb, root, buf, size));
+  return true;
+}
+
+bool gasnet::node_coll_reduce(
+    const team &tm, intrank_t root_or_all,
+    const void *src, void *dst,
+    std::size_t elt_sz, std::size_t elt_n,
+    std::uintptr_t ty_id, std::uintptr_t op_id,
+    void(*op_vecfn)(const void*, void*, std::size_t, const void*),
+    void *op_data,
+    handle_cb *cb
+  ) {
+  if(!node_eligible(tm, elt_sz*elt_n))
+    return false;
+
+  node_enqueue(new reduce_op(
+    cb, root_or_all, src, dst, elt_sz, elt_n,
+    (gex_DT_t)ty_id, (gex_OP_t)op_id, (gex_Coll_ReduceFn_t)op_vecfn, op_data
+  ));
+  return true;
+}
+
+void gasnet::node_coll_init(noise_log &noise) {
+  gex_TM_t world_tm = gasnet::handle_of(upcxx::world());
+  gex_TM_t local_tm = gasnet::handle_of(upcxx::local_team());
+
+  peer_n = backend::pshm_peer_n;
+  peer_me = backend::rank_me - backend::pshm_peer_lb;
+
+  bool want = os_env<bool>("UPCXX_NODE_COLL", true);
+  int64_t slot = os_env("UPCXX_NODE_COLL_SLOT", int64_t(2048), 1/* units: bytes */);
+  slot_size = slot < 64 ? 64 : (std::size_t(slot) + 63) & -std::size_t(64);
+
+  // A root's node and local index are computed from its rank, which needs
+  // every node to hold the same number of consecutive ranks. Everyone must
+  // agree to enable.
+  int64_t agree[4] = {
+    peer_n, -int64_t(peer_n),
+    backend::pshm_peer_lb % peer_n == 0 ? 1 : 0,
+    want ? 1 : 0
+  };
+  gex_Event_Wait(gex_Coll_ReduceToAllNB(
+    world_tm, agree, agree, GEX_DT_I64, sizeof(int64_t), 4, GEX_OP_MIN, nullptr, nullptr, 0
+  ));
+
+  gasnet::node_coll_enabled = agree[0] == -agree[1] && agree[0] > 1 && agree[2] && agree[3];
+
+  if(!gasnet::node_coll_enabled) {
+    if(backend::verbose_noise)
+      noise.line() << "Node-aware collectives disabled.";
+    return;
+  }
+
+  node_n = backend::rank_n/peer_n;
+  node_me = backend::rank_me/peer_n;
+
+  if(node_n > 1) {
+    gex_TM_t *p_leader_tm = peer_me == 0 ? &leader_tm : nullptr;
+
+    size_t scratch_sz = gex_TM_Split(
+      p_leader_tm, world_tm, 0, backend::rank_me, nullptr, 0,
+      GEX_FLAG_TM_SCRATCH_SIZE_RECOMMENDED
+    );
+    if(p_leader_tm) {
+      leader_scratch = gasnet::allocate(scratch_sz, GASNET_PAGESIZE, &gasnet::sheap_footprint_misc);
+      UPCXX_ASSERT_ALWAYS(leader_scratch != nullptr,
+        "Out of shared memory allocating "<<scratch_sz<<" bytes of team scratch space.");
+    }
+    gex_TM_Split(p_leader_tm, world_tm, 0, backend::rank_me, leader_scratch, scratch_sz, 0);
+  }
+
+  block_size = (1 + peer_n)*sizeof(node_flag) + (2 + peer_n)*slot_size;
+  std::uintptr_t block_addr = 0;
+
+  if(peer_me == 0) {
+    block = static_cast<char*>(gasnet::allocate(block_size, 64, &gasnet::sheap_footprint_misc));
+    UPCXX_ASSERT_ALWAYS(block != nullptr,
+      "Out of shared memory allocating "<<block_size<<" bytes for node-aware collectives.");
+    std::memset(block, 0, block_size);
+    for(intrank_t p=0; p < 1 + peer_n; p++)
+      ::new(&(release_flag() + p)->gen) std::atomic<std::uint64_t>(0);
+    block_addr = reinterpret_cast<std::uintptr_t>(block);
+  }
+
+  gex_Event_Wait(gex_Coll_BroadcastNB(local_tm, 0, &block_addr, &block_addr, sizeof(block_addr), 0));
+  block = reinterpret_cast<char*>(block_addr + backend::pshm_local_minus_remote[0]);
+  gen_next = 1;
+
+  if(backend::verbose_noise)
+    noise.line() << "Node-aware collectives enabled: " << node_n << " node(s) of "
+                 << peer_n << " ranks, slot size = " << slot_size << " bytes";
+}
+
+void gasnet::node_coll_finalize() {
+  if(!gasnet::node_coll_enabled)
+    return;
+
+  UPCXX_ASSERT_ALWAYS(node_q.empty());
+
+  // peers may still be copying out of the block after their last release
+  gex_Event_Wait(gex_Coll_BarrierNB(gasnet::handle_of(upcxx::local_team()), 0));
+
+  if(peer_me == 0)
+    gasnet::deallocate(block, &gasnet::sheap_footprint_misc);
+  block = nullptr;
+
+  if(leader_tm != GEX_TM_INVALID) {
+    gex_Memvec_t scratch_area;
+    gex_TM_Destroy(leader_tm, &scratch_area, GEX_FLAG_GLOBALLY_QUIESCED);
+    gasnet::deallocate(leader_scratch, &gasnet::sheap_footprint_misc);
+    leader_tm = GEX_TM_INVALID;
+    leader_scratch = nullptr;
+  }
+
+  gasnet::node_coll_enabled = false;
+}
@@ -7,6 +7,7 @@
 #include <upcxx/cuda_internal.hpp>
 #include <upcxx/os_env.hpp>
 #include <upcxx/reduce.hpp>
+#include <upcxx/task_pool_fwd.hpp>
 #include <upcxx/team.hpp>
 
 #include <algorithm>
@@ -15,9 +16,18 @@
 #include <cstring>
 #include <memory>
 #include <iomanip>
+#include <vector>
 
 #include <unistd.h>
 
+#if UPCXX_BACKEND_GASNET_PAR
+  #include <pthread.h>
+#endif
+
+#if __SSE2__
+  #include <emmintrin.h>
+#endif
+
 namespace backend = upcxx::backend;
 namespace detail  = upcxx::detail;
 namespace gasnet  = upcxx::backend::gasnet;
@@ -107,11 +117,50 @@ unique_ptr<uintptr_t[/*local_team.size()*/]> backend::pshm_local_minus_remote;
 unique_ptr<uintptr_t[/*local_team.size()*/]> backend::pshm_vbase;
 unique_ptr<uintptr_t[/*local_team.size()*/]> backend::pshm_size;
 
+size_t backend::local_copy_nt_min = size_t(-1);
+
+void backend::local_copy_nt(void *buf_d, void const *buf_s, size_t size) {
+#if __SSE2__
+  char *d = static_cast<char*>(buf_d);
+  char const *s = static_cast<char const*>(buf_s);
+
+  // align destination for the streaming stores
+  size_t head = std::min<size_t>(-reinterpret_cast<uintptr_t>(d) & 15, size);
+  std::memcpy(d, s, head);
+  d += head;
+  s += head;
+  size -= head;
+
+  size_t body = size & -size_t(64);
+  for(size_t i=0; i < body; i += 64) {
+    __m128i x0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + i +  0));
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + i + 16));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + i + 32));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + i + 48));
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + i +  0), x0);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + i + 16), x1);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + i + 32), x2);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + i + 48), x3);
+  }
+  std::memcpy(d + body, s + body, size - body);
+
+  // streaming stores are weakly ordered, make them visible before any
+  // completion is signaled
+  _mm_sfence();
+#else
+  std::memcpy(buf_d, buf_s, size);
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////
 // from: upcxx/backend/gasnet/runtime.hpp
 
 size_t gasnet::am_size_rdzv_cutover;
 size_t gasnet::am_size_rdzv_cutover_local;
+size_t gasnet::rpc_aggr_size = 0;
+size_t gasnet::reduce_ring_min;
+size_t gasnet::rma_chunk_size;
+int gasnet::rma_chunk_window;
 
 sheap_footprint_t gasnet::sheap_footprint_rdzv;
 sheap_footprint_t gasnet::sheap_footprint_misc;
@@ -140,6 +189,46 @@ namespace {
   #endif
 
   bool oversubscribed;
+
+  // RPC aggregation state, only touched with the master persona.
+  struct rpc_aggr_batch {
+    char *buf; // nullptr until first use, then `gasnet::rpc_aggr_size` bytes
+    std::size_t size;
+    gex_AM_Arg_t cmd_n;
+    bool dirty; // listed in `rpc_aggr_dirty`
+  };
+  // Each command in a batch is prefixed by one of these and padded to a
+  // multiple of its size.
+  struct rpc_aggr_cmd_header {
+    std::uint32_t cmd_size;
+    std::uint16_t cmd_align;
+    std::uint16_t level_user;
+  };
+  static_assert(0 == (sizeof(rpc_aggr_cmd_header) & (sizeof(rpc_aggr_cmd_header)-1)),
+                "rpc_aggr_cmd_header size must be a power of 2");
+  unique_ptr<rpc_aggr_batch[/*rank_n*/]> rpc_aggr_batches;
+  vector<intrank_t> rpc_aggr_dirty;
+  gasnett_tick_t rpc_aggr_oldest; // time at which `rpc_aggr_dirty` became non-empty
+  uint64_t rpc_aggr_age_ns;
+
+  void rpc_aggr_send(intrank_t recipient, rpc_aggr_batch &b);
+
+  // Receiver-side landing buffers for remote rdzv payloads, retained after
+  // use and binned by power-of-2 size class so that back-to-back large rpc's
+  // don't each pay a malloc/free (usually an mmap/munmap at these sizes) and
+  // fault in fresh pages. Every cached buffer is freeable with std::free.
+  struct rdzv_landing_cache {
+    static constexpr int class_n = 8*sizeof(size_t);
+    par_mutex lock;
+    vector<void*> bins[class_n];
+    size_t bytes = 0; // total held in `bins`
+    size_t bytes_max = 0; // UPCXX_RPC_RDZV_LANDING_CACHE
+  };
+  rdzv_landing_cache rdzv_landing;
+
+  void* rdzv_landing_acquire(size_t size, size_t align);
+  void rdzv_landing_release(void *buf, size_t size);
+  void rdzv_landing_drain();
   
   auto do_internal_progress = []() { upcxx::progress(progress_level::internal); };
   auto operation_cx_as_internal_future = upcxx::completions<upcxx::future_cx<upcxx::operation_cx_event, progress_level::internal>>{{}};
@@ -152,13 +241,14 @@ namespace {
 namespace {
   // we statically allocate the top of the AM handler space, 
   // to improve interoperability with UPCR that uses the bottom
-  #define UPCXX_NUM_AM_HANDLERS 8
+  #define UPCXX_NUM_AM_HANDLERS 9
   #define UPCXX_AM_INDEX_BASE   (256 - UPCXX_NUM_AM_HANDLERS)
   enum {
     id_am_eager_restricted = UPCXX_AM_INDEX_BASE,
     id_am_eager_master,
     id_am_eager_persona,
     id_am_bcast_master_eager,
+    id_am_eager_master_aggr,
     id_am_long_master_packed_cmd,
     id_am_long_master_payload_part,
     id_am_long_master_cmd_part,
@@ -175,6 +265,8 @@ namespace {
 
   void am_bcast_master_eager(gex_Token_t, void *buf, size_t buf_size, gex_AM_Arg_t buf_align_and_level);
 
+  void am_eager_master_aggr(gex_Token_t, void *buf, size_t buf_size, gex_AM_Arg_t cmd_n);
+
   void am_long_master_packed_cmd(gex_Token_t,
     void *payload, size_t payload_size,
     gex_AM_Arg_t reply_cb_lo, gex_AM_Arg_t reply_cb_hi,
@@ -208,6 +300,7 @@ namespace {
     AM_ENTRY(am_eager_master, 1),
     AM_ENTRY(am_eager_persona, 3),
     AM_ENTRY(am_bcast_master_eager, 1),
+    AM_ENTRY(am_eager_master_aggr, 1),
     {id_am_long_master_packed_cmd, (void(*)())am_long_master_packed_cmd, GEX_FLAG_AM_LONG | GEX_FLAG_AM_REQUEST, 16, nullptr, "am_long_master_packed_cmd"},
     {id_am_long_master_payload_part, (void(*)())am_long_master_payload_part, GEX_FLAG_AM_LONG | GEX_FLAG_AM_REQUEST, 5, nullptr, "am_long_master_payload_part"},
     {id_am_long_master_cmd_part, (void(*)())am_long_master_cmd_part, GEX_FLAG_AM_MEDIUM | GEX_FLAG_AM_REQUEST, 4, nullptr, "am_long_master_cmd_part"},
@@ -297,6 +390,21 @@ namespace {
   detail::par_mutex segment_lock_;
   mspace segment_mspace_;
 
+  // thread-cached front-end for small user allocations, see "shared heap
+  // thread caches" below
+  bool sheap_tcache_enabled = false;
+  void sheap_tcache_reset();
+  sheap_footprint_t sheap_footprint_user_total();
+  size_t sheap_tcache_slab_bytes();
+
+  // pre-reserved front-end for rdzv buffers, see "rdzv buffer pool" below
+  void rdzv_pool_init(noise_log &noise);
+  int64_t rdzv_pool_count();
+  size_t rdzv_pool_bytes();
+  // times the pool had to wait for a buffer to come back, and times it gave up
+  // and overflowed to the mspace
+  par_atomic<int64_t> rdzv_pool_stall_n{0}, rdzv_pool_overflow_n{0};
+
   // scratch space for the local_team, if required
   size_t local_scratch_sz = 0;
   void  *local_scratch_ptr = nullptr;
@@ -365,6 +473,13 @@ namespace {
     gasnet::sheap_footprint_rdzv = {0,0};
     gasnet::sheap_footprint_misc = {0,0};
     gasnet::sheap_footprint_user = {0,0};    
+
+    #if UPCXX_BACKEND_GASNET_PAR
+      sheap_tcache_enabled = !upcxx_use_upc_alloc &&
+                             upcxx::os_env<bool>("UPCXX_SHARED_HEAP_TCACHE", true);
+    #endif
+    sheap_tcache_reset();
+    rdzv_pool_init(noise);
     
     if(backend::verbose_noise) {
       uint64_t maxsz = shared_heap_sz;
@@ -423,12 +538,16 @@ void upcxx::destroy_heap() {
   
   gex_Event_Wait(gex_Coll_BarrierNB( gasnet::handle_of(upcxx::world()), 0));
   
-  if(gasnet::sheap_footprint_user.count != 0)
-    noise.warn()<<"destroy_heap() called with "<<gasnet::sheap_footprint_user.count<<" live shared objects.";
+  sheap_footprint_t user_foot = sheap_footprint_user_total();
+  if(user_foot.count != 0)
+    noise.warn()<<"destroy_heap() called with "<<user_foot.count<<" live shared objects.";
 
   if (upcxx_use_upc_alloc) { 
     noise.warn()<<"destroy_heap() is not supported for UPCXX_USE_UPC_ALLOC=yes" << endl;
   } else {
+    // node collectives keep state in the heap, restore_heap() rebuilds it
+    gasnet::node_coll_finalize();
+    
     destroy_mspace(segment_mspace_);
     segment_mspace_ = 0;
 
@@ -463,6 +582,7 @@ void upcxx::restore_heap(void) {
     noise_log mute = noise_log::muted();
     heap_init_internal(shared_heap_sz, mute);
     init_localheap_tables();
+    gasnet::node_coll_init(mute);
   }
   shared_heap_isinit = true;
 
@@ -673,6 +793,53 @@ void upcxx::init() {
   ENV_THRESH(gasnet::am_size_rdzv_cutover_local, "UPCXX_RPC_EAGER_THRESHOLD_LOCAL", 
              std::min(std::size_t(UPCXX_RPC_EAGER_THRESHOLD_LOCAL_DEFAULT),gasnet::am_size_rdzv_cutover)); 
 
+  //////////////////////////////////////////////////////////////////////////////
+  // RPC aggregation: opt-in coalescing of eager rpc/rpc_ff requests into one
+  // AM Medium per destination. Batches are sent when full, when the oldest
+  // pending command exceeds UPCXX_RPC_AGGR_AGE microseconds at progress(),
+  // and at barriers and finalize.
+  {
+    int64_t aggr_size = os_env("UPCXX_RPC_AGGR_SIZE", int64_t(0), 1/* units: bytes */);
+
+    if(aggr_size > 0) {
+      if((size_t)aggr_size < gasnet::am_size_rdzv_cutover_min) {
+        noise.warn() << "Requested UPCXX_RPC_AGGR_SIZE (" << aggr_size
+                     << ") is too small. Raised to minimum value (" << gasnet::am_size_rdzv_cutover_min << ")";
+        aggr_size = gasnet::am_size_rdzv_cutover_min;
+      }
+      if((size_t)aggr_size > am_medium_size) {
+        noise.warn() << "Requested UPCXX_RPC_AGGR_SIZE (" << aggr_size
+                     << ") is too large. Lowered to current maximum value (" << am_medium_size << ")";
+        aggr_size = am_medium_size;
+      }
+
+      gasnet::rpc_aggr_size = aggr_size;
+      rpc_aggr_age_ns = 1000*os_env("UPCXX_RPC_AGGR_AGE", int64_t(50), 0/* units: microseconds */);
+      rpc_aggr_batches.reset(new rpc_aggr_batch[backend::rank_n]()); // zero-init
+
+      if(backend::verbose_noise)
+        noise.line() << "RPC aggregation enabled: batch size = " << gasnet::rpc_aggr_size
+                     << " bytes, max age = " << rpc_aggr_age_ns/1000 << " us";
+    }
+  }
+
+  // Ring reduce-scatter cutover, see reduce.hpp
+  gasnet::reduce_ring_min = os_env("UPCXX_REDUCE_RING_MIN", int64_t(64<<10), 1/* units: bytes */);
+
+  // Chunked transfer defaults, see rma_chunked.hpp
+  gasnet::rma_chunk_size = os_env("UPCXX_RMA_CHUNK_SIZE", int64_t(4<<20), 1/* units: bytes */);
+  gasnet::rma_chunk_window = os_env<int>("UPCXX_RMA_CHUNK_WINDOW", 4);
+  UPCXX_ASSERT_ALWAYS(gasnet::rma_chunk_size > 0 && gasnet::rma_chunk_window > 0,
+                      "UPCXX_RMA_CHUNK_SIZE and UPCXX_RMA_CHUNK_WINDOW must be positive");
+
+  rdzv_landing.bytes_max = os_env("UPCXX_RPC_RDZV_LANDING_CACHE", int64_t(16<<20), 1/* units: bytes */);
+
+  backend::local_copy_nt_min = os_env("UPCXX_LOCAL_COPY_NT_MIN", int64_t(1<<20), 1/* units: bytes */);
+
+  // Blocks cached per size class per thread by the object pool, see object_pool.hpp
+  detail::obj_pool_depth = os_env<int>("UPCXX_OBJECT_POOL", detail::obj_pool_depth);
+  UPCXX_ASSERT_ALWAYS(detail::obj_pool_depth >= 0, "UPCXX_OBJECT_POOL must be non-negative");
+
 
   //////////////////////////////////////////////////////////////////////////////
   // Determine if we're oversubscribed.
@@ -836,6 +1003,8 @@ void upcxx::init() {
   // Setup local peer address translation tables
   init_localheap_tables();
 
+  gasnet::node_coll_init(noise);
+
   noise.show();
 
   if(backend::verbose_noise) {
@@ -934,7 +1103,7 @@ namespace {
     int64_t n;
 
     do {
-      n = gasnet::sheap_footprint_rdzv.count;
+      n = gasnet::sheap_footprint_rdzv.count + rdzv_pool_count();
       if(iters == (in_finalize ? 1000 : 100000)) {
         if(in_finalize) {
           if(upcxx::rank_me()==0)
@@ -985,6 +1154,9 @@ void upcxx::finalize() {
   
   noise_log noise("upcxx::finalize()");
 
+  if(gasnet::rpc_aggr_size != 0)
+    gasnet::rpc_aggr_flush();
+
   { // barrier
     // DO NOT convert this loop to backend::quiesce() which lacks the desired behavior
     gex_Event_t e = gex_Coll_BarrierNB( gasnet::handle_of(upcxx::world()), 0);
@@ -1029,7 +1201,7 @@ void upcxx::finalize() {
   }
   
   if(backend::verbose_noise) {
-    int64_t live_local = gasnet::sheap_footprint_user.count;
+    int64_t live_local = sheap_footprint_user_total().count;
     
     #if 0 // local_team scratch is no longer credited as a user allocation
     if(gasnet::handle_of(detail::the_local_team.value()) !=
@@ -1049,6 +1221,8 @@ void upcxx::finalize() {
     }
   }
   
+  gasnet::node_coll_finalize();
+  
   { // Tear down local_team
     if(gasnet::handle_of(detail::the_local_team.value()) !=
        gasnet::handle_of(detail::the_world_team.value())) {
@@ -1067,8 +1241,20 @@ void upcxx::finalize() {
     local_tm = GEX_TM_INVALID;
   }
   
+  detail::teams_finalize();
+  
   // can't just destroy world, it needs special attention
   detail::registry.erase(detail::the_world_team.value().id().dig_);
+
+  if(rpc_aggr_batches) {
+    rpc_aggr_dirty.clear();
+    for(intrank_t r=0; r < backend::rank_n; r++)
+      std::free(rpc_aggr_batches[r].buf);
+    rpc_aggr_batches.reset();
+    gasnet::rpc_aggr_size = 0;
+  }
+
+  rdzv_landing_drain();
   
   if(backend::initial_master_scope != nullptr)
     delete backend::initial_master_scope;
@@ -1099,17 +1285,32 @@ void  upcxx::deallocate(void *p) {
 }
 
 std::string upcxx::detail::shared_heap_stats() {
+  sheap_footprint_t user_foot = sheap_footprint_user_total();
   std::stringstream ss;
   ss
     <<"Local shared heap statistics:\n"
     <<"  Shared heap size on process "<<rank_me()<<":             "
     <<                       noise_log::size(shared_heap_sz) << '\n'
-    <<"  User allocations:      "<<setw(10)<<gasnet::sheap_footprint_user.count<<" objects, "
-    <<                       noise_log::size(gasnet::sheap_footprint_user.bytes)<<'\n'
+    <<"  User allocations:      "<<setw(10)<<user_foot.count<<" objects, "
+    <<                       noise_log::size(user_foot.bytes)<<'\n'
     <<"  Internal rdzv buffers: "<<setw(10)<<gasnet::sheap_footprint_rdzv.count<<" objects, "
     <<                       noise_log::size(gasnet::sheap_footprint_rdzv.bytes)<<'\n'
     <<"  Internal misc buffers: "<<setw(10)<<gasnet::sheap_footprint_misc.count<<" objects, "
     <<                       noise_log::size(gasnet::sheap_footprint_misc.bytes)<<'\n';
+  if(sheap_tcache_enabled) {
+    // slab space not currently handed out to the user (including headers)
+    int64_t cached_user = user_foot.bytes - gasnet::sheap_footprint_user.bytes;
+    ss
+    <<"  Thread cache slabs:                       "
+    <<                       noise_log::size(sheap_tcache_slab_bytes())<<" reserved, "
+    <<                       noise_log::size(sheap_tcache_slab_bytes() - cached_user)<<" overhead\n";
+  }
+  if(rdzv_pool_bytes() != 0)
+    ss
+    <<"  Rdzv buffer pool:      "<<setw(10)<<rdzv_pool_count()<<" in use,  "
+    <<                       noise_log::size(rdzv_pool_bytes())<<" reserved, "
+    <<                       rdzv_pool_stall_n.load(std::memory_order_relaxed)<<" stalls, "
+    <<                       rdzv_pool_overflow_n.load(std::memory_order_relaxed)<<" overflows\n";
   return ss.str();
 }
 
@@ -1122,15 +1323,606 @@ int64_t upcxx::shared_segment_size() {
 int64_t upcxx::shared_segment_used() {
   UPCXX_ASSERT_INIT();
   UPCXX_ASSERT(shared_heap_isinit);
-  return gasnet::sheap_footprint_user.bytes
+  // exact user bytes, the unused remainder of thread cache slabs is reported
+  // separately by shared_heap_stats()
+  return sheap_footprint_user_total().bytes
        + gasnet::sheap_footprint_rdzv.bytes
-       + gasnet::sheap_footprint_misc.bytes;
+       + gasnet::sheap_footprint_misc.bytes
+       + rdzv_pool_bytes();
 }
   
+////////////////////////////////////////////////////////////////////////
+// shared heap thread caches
+//
+// Under PAR, small user allocations are served from per-thread caches of
+// size-classed slabs so that threads only take `segment_lock_` to grab or
+// return a whole slab at a time. Slabs are aligned to their size, so any block
+// maps back to the header at the base of its slab, which names the owning
+// cache and size class and holds the slab's own free list. Only the owning
+// thread touches a slab's free list; a block freed by any other thread is
+// pushed onto the owner's MPSC return list for its class, which the owner
+// takes whole when it runs out of blocks and at exit. A slab whose blocks are
+// all free goes back to the mspace unless it's the last one its class has to
+// allocate from. When a thread exits its cache gives back every free slab and
+// is left for the next new thread to adopt; until then whoever frees into it
+// drains its return list and gives back emptied slabs under `segment_lock_`.
+
+namespace {
+#if UPCXX_BACKEND_GASNET_PAR
+  constexpr int sheap_tcache_class_n = 8; // 16 bytes .. 2 KB
+  constexpr size_t sheap_tcache_block_min = 16;
+  constexpr size_t sheap_tcache_block_max = sheap_tcache_block_min<<(sheap_tcache_class_n-1);
+  constexpr int sheap_tcache_slab_log2 = 16;
+  constexpr uintptr_t sheap_tcache_slab_size = uintptr_t(1)<<sheap_tcache_slab_log2;
+
+  struct sheap_tcache;
+
+  struct sheap_tcache_block {
+    sheap_tcache_block *next;
+  };
+
+  // Occupies the leading block(s) of every slab. All but `owner` and
+  // `class_ix` belong to the owning thread (or `segment_lock_` if orphaned).
+  struct sheap_tcache_slab {
+    sheap_tcache *owner;
+    int class_ix;
+    uint32_t used; // blocks out, including those in a return list
+    uintptr_t fresh; // offset of the first never carved block
+    sheap_tcache_block *free;
+    // neighbors in the owner's `avail_[class_ix]` while it has blocks to give
+    sheap_tcache_slab *prev, *next;
+  };
+
+  struct sheap_tcache {
+    sheap_tcache *next_all; // immutable once published to `sheap_tcache_all`
+    // owning thread exited, written under `segment_lock_`
+    std::atomic<bool> orphaned;
+
+    // only accessed by owning thread, slabs with blocks to give
+    sheap_tcache_slab *avail_[sheap_tcache_class_n];
+    // MPSC return lists: pushed by any thread, taken whole by owning thread
+    std::atomic<sheap_tcache_block*> remote_[sheap_tcache_class_n];
+
+    // Contribution of this thread to the user footprint. Only written by the
+    // owning thread, and may be negative since blocks can be freed by a thread
+    // other than the one that allocated them.
+    std::atomic<int64_t> user_count, user_bytes;
+  };
+
+  std::atomic<sheap_tcache*> sheap_tcache_all{nullptr};
+  std::atomic<size_t> sheap_tcache_slab_bytes_{0};
+
+  // One byte per slab-sized chunk of the shared heap, nonzero iff that chunk
+  // is a slab. Written under `segment_lock_`, read without since a slab can't
+  // go away while the block being freed is out.
+  unique_ptr<uint8_t[]> sheap_tcache_slab_map;
+  uintptr_t sheap_tcache_map_base;
+
+  __thread sheap_tcache *sheap_tcache_mine = nullptr;
+  pthread_key_t sheap_tcache_key; // destructor orphans the thread's cache
+  bool sheap_tcache_key_made = false;
+
+  inline uint8_t& sheap_tcache_slab_map_of(void *slab) {
+    return sheap_tcache_slab_map[(reinterpret_cast<uintptr_t>(slab) - sheap_tcache_map_base) >> sheap_tcache_slab_log2];
+  }
+
+  inline bool sheap_tcache_slab_full(sheap_tcache_slab *slab) {
+    return slab->free == nullptr && slab->fresh == sheap_tcache_slab_size;
+  }
+
+  void sheap_tcache_unlink(sheap_tcache *tc, sheap_tcache_slab *slab) {
+    (slab->prev ? slab->prev->next : tc->avail_[slab->class_ix]) = slab->next;
+    if(slab->next)
+      slab->next->prev = slab->prev;
+  }
+
+  void sheap_tcache_link(sheap_tcache *tc, sheap_tcache_slab *slab) {
+    sheap_tcache_slab *&head = tc->avail_[slab->class_ix];
+    slab->prev = nullptr;
+    slab->next = head;
+    if(head)
+      head->prev = slab;
+    head = slab;
+  }
+
+  // Give an unlinked, fully free slab back to the mspace. Caller holds
+  // `segment_lock_` iff `locked`.
+  void sheap_tcache_release(sheap_tcache_slab *slab, bool locked) {
+    UPCXX_ASSERT(slab->used == 0);
+    if(locked) {
+      sheap_tcache_slab_map_of(slab) = 0;
+      mspace_free(segment_mspace_, slab);
+    }
+    else {
+      std::lock_guard<detail::par_mutex> locked{segment_lock_};
+      sheap_tcache_slab_map_of(slab) = 0;
+      mspace_free(segment_mspace_, slab);
+    }
+    sheap_tcache_slab_bytes_.fetch_sub(sheap_tcache_slab_size, std::memory_order_relaxed);
+  }
+
+  // Return a block to its slab in `tc`, which must be the owner.
+  void sheap_tcache_put(sheap_tcache *tc, sheap_tcache_slab *slab, sheap_tcache_block *blk, bool locked) {
+    bool was_full = sheap_tcache_slab_full(slab);
+
+    blk->next = slab->free;
+    slab->free = blk;
+    slab->used -= 1;
+
+    if(was_full)
+      sheap_tcache_link(tc, slab);
+    else if(slab->used == 0 &&
+            (slab->prev != nullptr || slab->next != nullptr)) {
+      // all free and not the last one of its class
+      sheap_tcache_unlink(tc, slab);
+      sheap_tcache_release(slab, locked);
+    }
+  }
+
+  // Take the return list of class `c` and put its blocks back in their slabs.
+  void sheap_tcache_drain(sheap_tcache *tc, int c, bool locked) {
+    sheap_tcache_block *b = tc->remote_[c].exchange(nullptr, std::memory_order_seq_cst);
+    while(b != nullptr) {
+      sheap_tcache_block *b_next = b->next;
+      sheap_tcache_slab *slab = reinterpret_cast<sheap_tcache_slab*>(
+          reinterpret_cast<uintptr_t>(b) & -sheap_tcache_slab_size
+        );
+      sheap_tcache_put(tc, slab, b, locked);
+      b = b_next;
+    }
+  }
+
+  // Drain the return list of an orphaned cache and give back all its free
+  // slabs of class `c`. Caller holds `segment_lock_`.
+  void sheap_tcache_trim(sheap_tcache *tc, int c) {
+    sheap_tcache_drain(tc, c, /*locked=*/true);
+
+    sheap_tcache_slab *slab = tc->avail_[c];
+    while(slab != nullptr) {
+      sheap_tcache_slab *slab_next = slab->next;
+      if(slab->used == 0) {
+        sheap_tcache_unlink(tc, slab);
+        sheap_tcache_release(slab, /*locked=*/true);
+      }
+      slab = slab_next;
+    }
+  }
+
+  void sheap_tcache_orphan(void *tc1) {
+    sheap_tcache *tc = static_cast<sheap_tcache*>(tc1);
+    std::lock_guard<detail::par_mutex> locked{segment_lock_};
+
+    // From here on other threads trim our lists under the lock.
+    tc->orphaned.store(true, std::memory_order_seq_cst);
+
+    for(int c=0; c < sheap_tcache_class_n; c++)
+      sheap_tcache_trim(tc, c);
+  }
+
+  sheap_tcache* sheap_tcache_get() {
+    sheap_tcache *tc = sheap_tcache_mine;
+    if_pt(tc != nullptr)
+      return tc;
+
+    {
+      std::lock_guard<detail::par_mutex> locked{segment_lock_};
+
+      // adopt a cache (and the blocks it holds) left behind by an exited thread
+      for(tc = sheap_tcache_all.load(std::memory_order_acquire); tc != nullptr; tc = tc->next_all) {
+        if(tc->orphaned.load(std::memory_order_relaxed)) {
+          tc->orphaned.store(false, std::memory_order_relaxed);
+          break;
+        }
+      }
+
+      if(tc == nullptr) {
+        tc = new sheap_tcache(); // zero-init
+        tc->next_all = sheap_tcache_all.load(std::memory_order_relaxed);
+        sheap_tcache_all.store(tc, std::memory_order_release);
+      }
+    }
+
+    pthread_setspecific(sheap_tcache_key, tc);
+    sheap_tcache_mine = tc;
+    return tc;
+  }
+
+  inline int sheap_tcache_class_of(size_t size) {
+    int c = 0;
+    while((sheap_tcache_block_min<<c) < size)
+      c += 1;
+    return c;
+  }
+
+  inline bool sheap_tcache_owns(void *p) {
+    uintptr_t off = reinterpret_cast<uintptr_t>(p) - sheap_tcache_map_base;
+    UPCXX_ASSERT(off < shared_heap_sz + sheap_tcache_slab_size);
+    return sheap_tcache_slab_map[off >> sheap_tcache_slab_log2] != 0;
+  }
+
+  inline void sheap_tcache_foot_add(sheap_tcache *tc, int64_t count, int64_t bytes) {
+    tc->user_count.store(tc->user_count.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    tc->user_bytes.store(tc->user_bytes.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+  }
+
+  void* sheap_tcache_alloc(int c) {
+    sheap_tcache *tc = sheap_tcache_get();
+    size_t const block_sz = sheap_tcache_block_min<<c;
+    sheap_tcache_slab *slab = tc->avail_[c];
+
+    if_pf(slab == nullptr) {
+      sheap_tcache_drain(tc, c, /*locked=*/false);
+      slab = tc->avail_[c];
+
+      if(slab == nullptr) {
+        void *slab_p;
+        {
+          std::lock_guard<detail::par_mutex> locked{segment_lock_};
+          slab_p = mspace_memalign(segment_mspace_, sheap_tcache_slab_size, sheap_tcache_slab_size);
+          if(slab_p == nullptr)
+            return nullptr;
+          sheap_tcache_slab_map_of(slab_p) = 1;
+        }
+        sheap_tcache_slab_bytes_.fetch_add(sheap_tcache_slab_size, std::memory_order_relaxed);
+
+        slab = ::new(slab_p) sheap_tcache_slab;
+        slab->owner = tc;
+        slab->class_ix = c;
+        slab->used = 0;
+        // blocks are carved lazily past the header
+        slab->fresh = (sizeof(sheap_tcache_slab) + block_sz-1) & -block_sz;
+        slab->free = nullptr;
+        sheap_tcache_link(tc, slab);
+      }
+    }
+
+    void *p;
+    if(slab->free != nullptr) {
+      p = slab->free;
+      slab->free = slab->free->next;
+    }
+    else {
+      p = reinterpret_cast<char*>(slab) + slab->fresh;
+      slab->fresh += block_sz;
+    }
+    slab->used += 1;
+
+    if(sheap_tcache_slab_full(slab))
+      sheap_tcache_unlink(tc, slab);
+
+    sheap_tcache_foot_add(tc, 1, block_sz);
+    return p;
+  }
+
+  void sheap_tcache_free(void *p) {
+    sheap_tcache_slab *slab = reinterpret_cast<sheap_tcache_slab*>(
+        reinterpret_cast<uintptr_t>(p) & -sheap_tcache_slab_size
+      );
+    int c = slab->class_ix;
+    sheap_tcache *tc = sheap_tcache_get();
+    sheap_tcache *owner = slab->owner;
+    sheap_tcache_block *blk = static_cast<sheap_tcache_block*>(p);
+
+    sheap_tcache_foot_add(tc, -1, -int64_t(sheap_tcache_block_min<<c));
+
+    if(owner == tc)
+      sheap_tcache_put(tc, slab, blk, /*locked=*/false);
+    else {
+      std::atomic<sheap_tcache_block*> &remote = owner->remote_[c];
+      sheap_tcache_block *head = remote.load(std::memory_order_relaxed);
+      do blk->next = head;
+      while(!remote.compare_exchange_weak(head, blk, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+      // Either the owner's exit sees our push when it drains, or we see it
+      // exited and drain on its behalf.
+      if(owner->orphaned.load(std::memory_order_seq_cst)) {
+        std::lock_guard<detail::par_mutex> locked{segment_lock_};
+        if(owner->orphaned.load(std::memory_order_relaxed))
+          sheap_tcache_trim(owner, c);
+      }
+    }
+  }
+#endif
+
+  // Forget all slabs, called whenever the mspace is (re)created. No other
+  // threads may be allocating concurrently.
+  void sheap_tcache_reset() {
+  #if UPCXX_BACKEND_GASNET_PAR
+    if(!sheap_tcache_enabled)
+      return;
+
+    if(!sheap_tcache_key_made) {
+      int ok = pthread_key_create(&sheap_tcache_key, sheap_tcache_orphan);
+      UPCXX_ASSERT_ALWAYS(ok == 0);
+      sheap_tcache_key_made = true;
+    }
+
+    uintptr_t heap_lo = reinterpret_cast<uintptr_t>(shared_heap_base);
+    sheap_tcache_map_base = heap_lo & -sheap_tcache_slab_size;
+    size_t chunk_n = ((heap_lo + shared_heap_sz - sheap_tcache_map_base) >> sheap_tcache_slab_log2) + 1;
+    sheap_tcache_slab_map.reset(new uint8_t[chunk_n]()); // zero-init
+
+    for(sheap_tcache *tc = sheap_tcache_all.load(std::memory_order_acquire); tc != nullptr; tc = tc->next_all) {
+      for(int c=0; c < sheap_tcache_class_n; c++) {
+        tc->avail_[c] = nullptr;
+        tc->remote_[c].store(nullptr, std::memory_order_relaxed);
+      }
+      tc->user_count.store(0, std::memory_order_relaxed);
+      tc->user_bytes.store(0, std::memory_order_relaxed);
+    }
+    sheap_tcache_slab_bytes_.store(0, std::memory_order_relaxed);
+  #endif
+  }
+
+  // Exact user footprint, includes what's been handed out by thread caches.
+  sheap_footprint_t sheap_footprint_user_total() {
+    sheap_footprint_t foot = gasnet::sheap_footprint_user;
+  #if UPCXX_BACKEND_GASNET_PAR
+    for(sheap_tcache *tc = sheap_tcache_all.load(std::memory_order_acquire); tc != nullptr; tc = tc->next_all) {
+      foot.count += tc->user_count.load(std::memory_order_relaxed);
+      foot.bytes += tc->user_bytes.load(std::memory_order_relaxed);
+    }
+  #endif
+    return foot;
+  }
+
+  size_t sheap_tcache_slab_bytes() {
+  #if UPCXX_BACKEND_GASNET_PAR
+    return sheap_tcache_slab_bytes_.load(std::memory_order_relaxed);
+  #else
+    return 0;
+  #endif
+  }
+}
+
+////////////////////////////////////////////////////////////////////////
+// rdzv buffer pool
+//
+// Rendezvous staging buffers (rpc and broadcast payloads, copy bounce
+// buffers) come and go at message rate, so rather than running each through
+// dlmalloc they are served from a region reserved out of the shared heap at
+// init. The region is cut into slabs of the largest block size. A slab is
+// given to one power-of-2 size class when that class runs out of free blocks,
+// and goes back to the shared list of free slabs as soon as all of its blocks
+// have been released, so no class can starve the others for good. When a
+// class has blocks out and nothing free the allocating thread polls the
+// network for up to `UPCXX_RDZV_POOL_WAIT` microseconds so that buffers
+// released by remote GETs can come back, and only then overflows to the
+// mspace. A class with nothing out has nothing to wait for and overflows
+// immediately.
+
+namespace {
+  constexpr int rdzv_pool_class_n = 11; // 1 KB .. 1 MB
+  constexpr size_t rdzv_pool_block_min = 1<<10;
+  constexpr size_t rdzv_pool_slab_size = rdzv_pool_block_min<<(rdzv_pool_class_n-1);
+
+  struct rdzv_pool_block {
+    rdzv_pool_block *next;
+  };
+
+  struct rdzv_pool_slab {
+    int cls; // -1 while on the free slab list
+    size_t used; // blocks handed out
+    size_t fresh; // offset of the first never-used byte
+    rdzv_pool_block *free; // released blocks
+    // neighbors on the free slab list, or the class's list of slabs with
+    // blocks to give, -1 terminated
+    int64_t prev, next;
+  };
+
+  struct rdzv_pool_state {
+    detail::par_mutex lock;
+    char *base = nullptr; // null if disabled
+    size_t slab_n = 0;
+    unique_ptr<rdzv_pool_slab[/*slab_n*/]> slabs;
+    int64_t free_slabs; // list head
+    int64_t avail_[rdzv_pool_class_n]; // list heads
+    size_t used_[rdzv_pool_class_n]; // blocks handed out per class
+    int64_t wait_ns;
+    // buffers handed out, written under `lock`
+    par_atomic<int64_t> count{0};
+  };
+  rdzv_pool_state rdzv_pool;
+
+  void rdzv_pool_unlink(int64_t &head, int64_t s) {
+    rdzv_pool_slab &x = rdzv_pool.slabs[s];
+    (x.prev == -1 ? head : rdzv_pool.slabs[x.prev].next) = x.next;
+    if(x.next != -1)
+      rdzv_pool.slabs[x.next].prev = x.prev;
+  }
+
+  void rdzv_pool_link(int64_t &head, int64_t s) {
+    rdzv_pool_slab &x = rdzv_pool.slabs[s];
+    x.prev = -1;
+    x.next = head;
+    if(head != -1)
+      rdzv_pool.slabs[head].prev = s;
+    head = s;
+  }
+
+  // Called whenever the mspace is (re)created. No rdzv buffers may be live.
+  void rdzv_pool_init(noise_log &noise) {
+    rdzv_pool.base = nullptr;
+    rdzv_pool.slab_n = 0;
+    rdzv_pool.slabs.reset();
+    rdzv_pool.free_slabs = -1;
+    for(int c=0; c < rdzv_pool_class_n; c++) {
+      rdzv_pool.avail_[c] = -1;
+      rdzv_pool.used_[c] = 0;
+    }
+    rdzv_pool.count.store(0, std::memory_order_relaxed);
+    rdzv_pool_stall_n.store(0, std::memory_order_relaxed);
+    rdzv_pool_overflow_n.store(0, std::memory_order_relaxed);
+
+    if(upcxx_use_upc_alloc)
+      return;
+
+    int64_t size = os_env("UPCXX_RDZV_POOL_SIZE",
+                          std::min<int64_t>(shared_heap_sz/16, 8<<20), 1/* units: bytes */);
+    rdzv_pool.wait_ns = 1000*os_env("UPCXX_RDZV_POOL_WAIT", int64_t(100), 0/* units: microseconds */);
+    
+    size_t slab_n = size_t(std::max<int64_t>(size, 0))/rdzv_pool_slab_size;
+    if(slab_n == 0)
+      return;
+
+    void *base = mspace_memalign(segment_mspace_, rdzv_pool_slab_size, slab_n*rdzv_pool_slab_size);
+    if(base == nullptr) {
+      noise.warn()<<"UPCXX_RDZV_POOL_SIZE="<<size<<" does not fit in the shared heap, "
+                    "rdzv buffer pool disabled.";
+      return;
+    }
+    
+    rdzv_pool.base = static_cast<char*>(base);
+    rdzv_pool.slab_n = slab_n;
+    rdzv_pool.slabs.reset(new rdzv_pool_slab[slab_n]);
+    for(size_t s = slab_n; s-- != 0;) {
+      rdzv_pool.slabs[s].cls = -1;
+      rdzv_pool_link(rdzv_pool.free_slabs, s);
+    }
+
+    if(backend::verbose_noise)
+      noise.line()<<"Rdzv buffer pool: "<<noise_log::size(slab_n*rdzv_pool_slab_size)
+                  <<" reserved, max wait = "<<rdzv_pool.wait_ns/1000<<" us";
+  }
+
+  int64_t rdzv_pool_count() {
+    return rdzv_pool.count.load(std::memory_order_relaxed);
+  }
+
+  size_t rdzv_pool_bytes() {
+    return rdzv_pool.slab_n*rdzv_pool_slab_size;
+  }
+
+  bool rdzv_pool_owns(void *p) {
+    return rdzv_pool.base <= (char*)p && (char*)p < rdzv_pool.base + rdzv_pool_bytes();
+  }
+
+  // Returns null if the pool has nothing of this class free, in which case
+  // `may_wait` tells whether any blocks of the class are out to come back.
+  void* rdzv_pool_try_alloc(int c, bool &may_wait) {
+    std::lock_guard<detail::par_mutex> locked{rdzv_pool.lock};
+    size_t const blk_size = rdzv_pool_block_min<<c;
+    
+    int64_t s = rdzv_pool.avail_[c];
+    if(s == -1) {
+      s = rdzv_pool.free_slabs;
+      if(s == -1) {
+        may_wait = rdzv_pool.used_[c] != 0;
+        return nullptr;
+      }
+      
+      rdzv_pool_unlink(rdzv_pool.free_slabs, s);
+      rdzv_pool_slab &x = rdzv_pool.slabs[s];
+      x.cls = c;
+      x.used = 0;
+      x.fresh = 0;
+      x.free = nullptr;
+      rdzv_pool_link(rdzv_pool.avail_[c], s);
+    }
+    
+    rdzv_pool_slab &x = rdzv_pool.slabs[s];
+    void *p;
+    if(x.free != nullptr) {
+      p = x.free;
+      x.free = x.free->next;
+    }
+    else {
+      p = rdzv_pool.base + s*rdzv_pool_slab_size + x.fresh;
+      x.fresh += blk_size;
+    }
+    
+    x.used += 1;
+    if(x.free == nullptr && x.fresh == rdzv_pool_slab_size)
+      rdzv_pool_unlink(rdzv_pool.avail_[c], s); // full
+    
+    rdzv_pool.used_[c] += 1;
+    rdzv_pool.count.store(rdzv_pool.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return p;
+  }
+
+  // Returns null if the request isn't poolable or the pool stayed exhausted.
+  void* rdzv_pool_alloc(size_t size, size_t alignment) {
+    size_t need = std::max(size, alignment);
+    if(rdzv_pool.base == nullptr || need > rdzv_pool_slab_size)
+      return nullptr;
+
+    int c = 0;
+    while((rdzv_pool_block_min<<c) < need) c++;
+
+    bool may_wait;
+    void *p = rdzv_pool_try_alloc(c, may_wait);
+    if_pt(p != nullptr)
+      return p;
+
+    if(may_wait && rdzv_pool.wait_ns != 0) {
+      // Backpressure: buffers come back through restricted AMs, which only
+      // need the network polled, not a full progress call.
+      rdzv_pool_stall_n.fetch_add(1, std::memory_order_relaxed);
+      gasnett_tick_t t0 = gasnett_ticks_now();
+      do {
+        gasnet_AMPoll();
+        p = rdzv_pool_try_alloc(c, may_wait);
+        if(p != nullptr)
+          return p;
+      } while(may_wait && gasnett_ticks_to_ns(gasnett_ticks_now() - t0) < uint64_t(rdzv_pool.wait_ns));
+    }
+
+    rdzv_pool_overflow_n.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  void rdzv_pool_free(void *p) {
+    std::lock_guard<detail::par_mutex> locked{rdzv_pool.lock};
+    
+    size_t s = ((char*)p - rdzv_pool.base)/rdzv_pool_slab_size;
+    rdzv_pool_slab &x = rdzv_pool.slabs[s];
+    int c = x.cls;
+    UPCXX_ASSERT(c >= 0 && x.used != 0 && detail::is_aligned(p, rdzv_pool_block_min<<c));
+    
+    bool was_full = x.free == nullptr && x.fresh == rdzv_pool_slab_size;
+    
+    x.used -= 1;
+    rdzv_pool.used_[c] -= 1;
+    rdzv_pool.count.store(rdzv_pool.count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    
+    if(x.used == 0) {
+      // every block is back, the slab can serve any class now
+      if(!was_full)
+        rdzv_pool_unlink(rdzv_pool.avail_[c], s);
+      x.cls = -1;
+      rdzv_pool_link(rdzv_pool.free_slabs, s);
+      return;
+    }
+    
+    rdzv_pool_block *blk = static_cast<rdzv_pool_block*>(p);
+    blk->next = x.free;
+    x.free = blk;
+    
+    if(was_full)
+      rdzv_pool_link(rdzv_pool.avail_[c], s);
+  }
+}
+
 void* gasnet::allocate(size_t size, size_t alignment, sheap_footprint_t *foot) {
   UPCXX_ASSERT(shared_heap_isinit);
   UPCXX_ASSERT_MASTER_IFSEQ();
 
+  if(foot == &gasnet::sheap_footprint_rdzv) {
+    void *p = rdzv_pool_alloc(size, alignment);
+    if_pt(p != nullptr)
+      return p;
+  }
+
+  #if UPCXX_BACKEND_GASNET_PAR
+    if(sheap_tcache_enabled && foot == &gasnet::sheap_footprint_user &&
+       size <= sheap_tcache_block_max && alignment <= sheap_tcache_block_max) {
+      void *p = sheap_tcache_alloc(sheap_tcache_class_of(std::max(size, alignment)));
+      if_pt(p != nullptr)
+        return p;
+      // no room for another slab, the mspace may still fit this request
+    }
+  #endif
+
   std::lock_guard<detail::par_mutex> locked{segment_lock_};
   
   void *p;
@@ -1175,6 +1967,19 @@ void gasnet::deallocate(void *p, sheap_footprint_t *foot) {
   UPCXX_ASSERT(shared_heap_isinit);
   UPCXX_ASSERT_MASTER_IFSEQ();
 
+  if(foot == &gasnet::sheap_footprint_rdzv && rdzv_pool_owns(p)) {
+    rdzv_pool_free(p);
+    return;
+  }
+
+  #if UPCXX_BACKEND_GASNET_PAR
+    if(sheap_tcache_enabled && foot == &gasnet::sheap_footprint_user &&
+       p != nullptr && sheap_tcache_owns(p)) {
+      sheap_tcache_free(p);
+      return;
+    }
+  #endif
+
   std::lock_guard<detail::par_mutex> locked{segment_lock_};
   
   if_pf (!p) return;
@@ -1206,6 +2011,9 @@ void backend::quiesce(const team &tm, upcxx::entry_barrier eb) {
     break;
   case entry_barrier::internal:
   case entry_barrier::user: {
+      if(gasnet::rpc_aggr_size != 0 && backend::master.active_with_caller())
+        gasnet::rpc_aggr_flush();
+
       // memory fencing is handled inside gex_Coll_BarrierNB + gex_Event_Test
       //std::atomic_thread_fence(std::memory_order_release);
       
@@ -1601,6 +2409,91 @@ void gasnet::send_am_eager_persona(
   after_gasnet();
 }
 
+bool gasnet::rpc_aggr_append(
+    progress_level level,
+    intrank_t recipient,
+    void const *buf,
+    std::size_t buf_size,
+    std::size_t buf_align
+  ) {
+  constexpr std::size_t hdr_size = sizeof(rpc_aggr_cmd_header);
+  std::size_t rec_size = hdr_size + ((buf_size + hdr_size-1) & -hdr_size);
+
+  if(rec_size > gasnet::rpc_aggr_size)
+    return false;
+
+  #if UPCXX_BACKEND_GASNET_PAR
+    // batches belong to the master persona
+    if(!backend::master.active_with_caller())
+      return false;
+  #endif
+
+  rpc_aggr_batch &b = rpc_aggr_batches[recipient];
+
+  if(b.size + rec_size > gasnet::rpc_aggr_size) {
+    rpc_aggr_send(recipient, b);
+    after_gasnet();
+  }
+
+  if(b.buf == nullptr) {
+    b.buf = static_cast<char*>(std::malloc(gasnet::rpc_aggr_size));
+    UPCXX_ASSERT_ALWAYS(b.buf != nullptr);
+  }
+
+  if(!b.dirty) {
+    if(rpc_aggr_dirty.empty())
+      rpc_aggr_oldest = gasnett_ticks_now();
+    rpc_aggr_dirty.push_back(recipient);
+    b.dirty = true;
+  }
+
+  rpc_aggr_cmd_header hdr;
+  hdr.cmd_size = buf_size;
+  hdr.cmd_align = buf_align;
+  hdr.level_user = level == progress_level::user ? 1 : 0;
+
+  std::memcpy(b.buf + b.size, &hdr, hdr_size);
+  std::memcpy(b.buf + b.size + hdr_size, buf, buf_size);
+  b.size += rec_size;
+  b.cmd_n += 1;
+
+  return true;
+}
+
+void gasnet::rpc_aggr_flush() {
+  UPCXX_ASSERT(backend::master.active_with_caller());
+
+  if(rpc_aggr_dirty.empty())
+    return;
+
+  do {
+    intrank_t r = rpc_aggr_dirty.back();
+    rpc_aggr_dirty.pop_back();
+    rpc_aggr_batches[r].dirty = false;
+    rpc_aggr_send(r, rpc_aggr_batches[r]);
+  } while(!rpc_aggr_dirty.empty());
+
+  after_gasnet();
+}
+
+namespace {
+  void rpc_aggr_send(intrank_t recipient, rpc_aggr_batch &b) {
+    if(b.cmd_n == 0)
+      return;
+
+    // GEX_EVENT_NOW: the batch buffer is reusable upon return
+    gex_AM_RequestMedium1(
+      world_tm, recipient,
+      id_am_eager_master_aggr, b.buf, b.size,
+      GEX_EVENT_NOW, /*flags*/0,
+      b.cmd_n
+    );
+
+    b.size = 0;
+    b.cmd_n = 0;
+  }
+}
+
 namespace {
   template<typename Fn>
   void rma_get(
@@ -1622,7 +2515,7 @@ namespace {
     );
     cb->handle = reinterpret_cast<uintptr_t>(h);
     
-    gasnet::register_cb(cb);
+    gasnet::register_cb(cb, gasnet::handle_cb_class::rma_get);
     gasnet::after_gasnet();
   }
 }
@@ -1892,7 +2785,9 @@ namespace gasnet {
             shared_heap_base <= me->payload &&
             (char*)me->payload < (char*)shared_heap_base + shared_heap_sz
           ));
-          std::free(me->payload); 
+          // `me` lives at the tail of its own landing buffer
+          size_t buf_size = (char*)me - (char*)me->payload + sizeof(rpc_as_lpc);
+          rdzv_landing_release(me->payload, buf_size);
         }
       }
     }
@@ -1982,6 +2877,75 @@ RpcAsLpc* rpc_as_lpc::build_eager(
   return m;
 }
 
+namespace {
+  int rdzv_landing_class(size_t size) {
+    int c = 0;
+    while((size_t(1)<<c) < size) c++;
+    return c;
+  }
+
+  void* rdzv_landing_acquire(size_t size, size_t align) {
+    int c = rdzv_landing_class(size);
+    size_t class_size = size_t(1)<<c;
+    
+    // never cacheable, so don't round it up
+    if(class_size > rdzv_landing.bytes_max)
+      return detail::alloc_aligned(size, std::max<size_t>(align, 64));
+    
+    {
+      std::lock_guard<par_mutex> locked{rdzv_landing.lock};
+      vector<void*> &bin = rdzv_landing.bins[c];
+      
+      // cached buffers are at least 64-byte aligned, larger requests take
+      // whichever cached buffer happens to satisfy them
+      for(size_t i = bin.size(); i-- != 0;) {
+        void *buf = bin[i];
+        if(detail::is_aligned(buf, align)) {
+          bin[i] = bin.back();
+          bin.pop_back();
+          rdzv_landing.bytes -= class_size;
+          return buf;
+        }
+      }
+    }
+    
+    // Allocate the whole class so the buffer can be cached on release.
+    return detail::alloc_aligned(class_size, std::max<size_t>(align, 64));
+  }
+
+  void rdzv_landing_release(void *buf, size_t size) {
+    int c = rdzv_landing_class(size);
+    size_t class_size = size_t(1)<<c;
+    
+    // allocated at exactly `size` by rdzv_landing_acquire()
+    if(class_size > rdzv_landing.bytes_max) {
+      std::free(buf);
+      return;
+    }
+    
+    {
+      std::lock_guard<par_mutex> locked{rdzv_landing.lock};
+      if(rdzv_landing.bytes + class_size <= rdzv_landing.bytes_max) {
+        rdzv_landing.bins[c].push_back(buf);
+        rdzv_landing.bytes += class_size;
+        return;
+      }
+    }
+    std::free(buf);
+  }
+
+  void rdzv_landing_drain() {
+    std::lock_guard<par_mutex> locked{rdzv_landing.lock};
+    for(vector<void*> &bin: rdzv_landing.bins) {
+      for(void *buf: bin)
+        std::free(buf);
+      bin.clear();
+      bin.shrink_to_fit();
+    }
+    rdzv_landing.bytes = 0;
+  }
+}
+
 template<typename RpcAsLpc>
 RpcAsLpc* rpc_as_lpc::build_rdzv_lz(
     bool use_sheap,
@@ -1996,7 +2960,7 @@ RpcAsLpc* rpc_as_lpc::build_rdzv_lz(
   if(use_sheap)
     buf = gasnet::allocate(buf_size, buf_align, &gasnet::sheap_footprint_rdzv);
   else
-    buf = detail::alloc_aligned(buf_size, buf_align);
+    buf = rdzv_landing_acquire(buf_size, buf_align);
   UPCXX_ASSERT_ALWAYS(buf != nullptr);
 
   char *p = (char*)buf + offset;
@@ -2082,9 +3046,18 @@ void upcxx::progress(progress_level level) {
   int total_exec_n = 0;
   int exec_n;
   
+  if(gasnet::rpc_aggr_size != 0 &&
+     backend::master.active_with_caller(tls) &&
+     !rpc_aggr_dirty.empty() &&
+     gasnett_ticks_to_ns(gasnett_ticks_now() - rpc_aggr_oldest) >= rpc_aggr_age_ns)
+    gasnet::rpc_aggr_flush();
+
   if(!UPCXX_BACKEND_GASNET_SEQ || gasnet_seq_thread_id == detail::thread_id())
     gasnet_AMPoll();
   
+  if(gasnet::node_coll_enabled && backend::master.active_with_caller(tls))
+    gasnet::node_coll_poll();
+  
   do {
     exec_n = 0;
     
@@ -2136,6 +3109,10 @@ void upcxx::progress(progress_level level) {
   
   tls.flip_burstable(progress_level::user);
   tls.set_progressing(-1);
+
+  // a thread inside task_pool::run() with nothing else to do takes a task
+  if(level == progress_level::user && total_exec_n == 0)
+    detail::task_pool_idle();
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -2264,6 +3241,42 @@ namespace {
     
     tls.enqueue(backend::master, level, m, known_active);
   }
+
+  void am_eager_master_aggr(
+      gex_Token_t,
+      void *buf, size_t buf_size,
+      gex_AM_Arg_t cmd_n
+    ) {
+
+    UPCXX_ASSERT(backend::rank_n != -1);
+
+    constexpr size_t hdr_size = sizeof(rpc_aggr_cmd_header);
+    detail::persona_tls &tls = detail::the_persona_tls;
+    char *p = static_cast<char*>(buf);
+    char *end = p + buf_size;
+
+    // Each command becomes its own rpc_as_lpc, exactly as if it had arrived
+    // via am_eager_master.
+    while(p != end) {
+      UPCXX_ASSERT(p < end);
+
+      rpc_aggr_cmd_header hdr;
+      std::memcpy(&hdr, p, hdr_size);
+
+      rpc_as_lpc *m = rpc_as_lpc::build_eager(p + hdr_size, hdr.cmd_size, hdr.cmd_align);
+
+      tls.enqueue(
+        backend::master,
+        hdr.level_user ? progress_level::user : progress_level::internal,
+        m,
+        /*known_active=*/std::integral_constant<bool, !UPCXX_BACKEND_GASNET_PAR>()
+      );
+
+      p += hdr_size + ((hdr.cmd_size + hdr_size-1) & -hdr_size);
+      cmd_n -= 1;
+    }
+    UPCXX_ASSERT(cmd_n == 0);
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2572,7 +3585,7 @@ namespace {
 
 ////////////////////////////////////////////////////////////////////////
 
-inline int handle_cb_queue::burst(bool maybe_spinning) {
+int handle_cb_list::burst(bool maybe_spinning) {
   // Gasnet present's its asynchrony through pollable handles which is
   // problematic for us since we need to guess a good strategy for choosing
   // handles to poll which minimizes time wasted polling non-ready handles.
@@ -2593,6 +3606,18 @@ inline int handle_cb_queue::burst(bool maybe_spinning) {
   // to linearly increase with the abort counter so that a recent history of
   // repeated failure motivates us to look harder for ready handles.
 
+  // Handles are tested in batches with a single gex_Event_TestSome() call.
+  // Each batch is sized to the number of misses we can still afford before
+  // aborting, so a batch with no ready handles costs no more polling than the
+  // equivalent run of individual tests would have.
+  //
+  // Each list holds handles of only one handle_cb_class, since the in-order
+  // retirement assumption only holds among operations of the same kind.
+
+  constexpr int batch_max = 16;
+  handle_cb *batch_cb[batch_max];
+  gex_Event_t batch_ev[batch_max];
+  
   int exec_n = 0;
   handle_cb **pp = &this->head_;
 
@@ -2610,41 +3635,85 @@ inline int handle_cb_queue::burst(bool maybe_spinning) {
   // history of aborted burst()'s pile up, this grows in negativity to allow us
   // to see beyond the nefarious N-cluster which may have percolated to the front.
   int miss_n = -4*aborted_burst_n_and_spinning;
+
+  if(*pp != nullptr)
+    this->stats_.bursts += 1;
   
   while(*pp != nullptr) {
-    handle_cb *p = *pp;
-    gex_Event_t ev = reinterpret_cast<gex_Event_t>(p->handle);
-    
-    if(0 == gex_Event_Test(ev)) {
-      // remove from queue
-      *pp = p->next_;
-      if(*pp == nullptr)
-        this->set_tailp(pp);
-      
-      // do it!
-      p->execute_and_delete(handle_cb_successor{this, pp});
-      
-      exec_n += 1;
-      
-      // Break the miss streak. Intentionally clobber negative values since now
-      // that the app has learned of completed communication, it may have more
-      // productive work to do outside of progress(), so we should feel pressure
-      // to abort.
-      miss_n = 0;
-      
-      aborted_burst_n = 0; // Reset abort history.
+    // gather the next batch
+    int batch_n = 0;
+    int batch_want = std::min<int>(batch_max, miss_limit - miss_n);
+    bool some_invalid = false;
+    
+    for(handle_cb *p = *pp; p != nullptr && batch_n < batch_want; p = p->next_) {
+      gex_Event_t ev = reinterpret_cast<gex_Event_t>(p->handle);
+      some_invalid |= ev == GEX_EVENT_INVALID;
+      batch_cb[batch_n] = p;
+      batch_ev[batch_n] = ev;
+      batch_n += 1;
+    }
+
+    this->stats_.tests += batch_n;
+    
+    // Events found ready are overwritten with GEX_EVENT_INVALID. An event
+    // which was invalid to begin with is trivially ready, but TestSome won't
+    // report it as such.
+    bool some_ready;
+    if(batch_n == 1) {
+      some_ready = 0 == gex_Event_Test(batch_ev[0]);
+      if(some_ready)
+        batch_ev[0] = GEX_EVENT_INVALID;
+    }
+    else
+      some_ready = GASNET_OK == gex_Event_TestSome(batch_ev, batch_n, /*flags*/0)
+                || some_invalid;
+
+    if(!some_ready) {
+      miss_n += batch_n;
+      this->stats_.misses += batch_n;
+      pp = &batch_cb[batch_n-1]->next_;
     }
     else {
-      miss_n += 1;
-      if(miss_n == miss_limit) { // Miss streak triggered abort.
-        // Only increase abort history if we are spinning and this burst() was
-        // entirely fruitless.
-        if(maybe_spinning && exec_n == 0)
-          aborted_burst_n = std::min<int>(aborted_burst_n + 1, 1024);
-        break;
+      for(int i=0; i < batch_n; i++) {
+        handle_cb *p = batch_cb[i];
+        // skip over successors inserted by callbacks executed earlier in
+        // this batch, they'll be tested next burst()
+        while(*pp != p)
+          pp = &(*pp)->next_;
+        
+        if(batch_ev[i] == GEX_EVENT_INVALID) {
+          // remove from queue
+          *pp = p->next_;
+          if(*pp == nullptr)
+            this->set_tailp(pp);
+          
+          // do it!
+          p->execute_and_delete(handle_cb_successor{this, pp});
+          
+          exec_n += 1;
+          
+          // Break the miss streak. Intentionally clobber negative values since now
+          // that the app has learned of completed communication, it may have more
+          // productive work to do outside of progress(), so we should feel pressure
+          // to abort.
+          miss_n = 0;
+          
+          aborted_burst_n = 0; // Reset abort history.
+        }
+        else {
+          miss_n += 1;
+          this->stats_.misses += 1;
+          pp = &p->next_;
+        }
       }
-      
-      pp = &p->next_;
+    }
+    
+    if(miss_n >= miss_limit) { // Miss streak triggered abort.
+      // Only increase abort history if we are spinning and this burst() was
+      // entirely fruitless.
+      if(maybe_spinning && exec_n == 0)
+        aborted_burst_n = std::min<int>(aborted_burst_n + 1, 1024);
+      break;
     }
   }
 
@@ -2653,6 +3722,15 @@ inline int handle_cb_queue::burst(bool maybe_spinning) {
   return exec_n;
 }
 
+inline int handle_cb_queue::burst(bool maybe_spinning) {
+  int exec_n = 0;
+  for(handle_cb_list &l: this->lists_) {
+    if(!l.empty())
+      exec_n += l.burst(maybe_spinning);
+  }
+  return exec_n;
+}
+
 ////////////////////////////////////////////////////////////////////////
 // from: upcxx/os_env.hpp
 
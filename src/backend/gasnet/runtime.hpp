@@ -48,7 +48,7 @@ namespace gasnet {
   void after_gasnet();
 
   // Register a handle callback for the current persona
-  void register_cb(handle_cb *cb);
+  void register_cb(handle_cb *cb, handle_cb_class cls);
   
   // Send AM (packed command), receiver executes in handler.
   void send_am_eager_restricted(
@@ -91,9 +91,37 @@ namespace gasnet {
     std::size_t buf_size, std::size_t buf_align
   );
 
-  void *prepare_npam_medium(intrank_t recipient, std::size_t buf_size,          
+  void *prepare_npam_medium(intrank_t recipient, std::size_t buf_size,
                             int numargs, std::uintptr_t &npam_nonce);
 
+  // RPC aggregation (UPCXX_RPC_AGGR_SIZE): zero when disabled, otherwise the
+  // capacity in bytes of each per-destination batch.
+  extern std::size_t rpc_aggr_size;
+
+  // Slice size in bytes at or above which reduce_scatter and
+  // reduce_all_inplace use the ring algorithm instead of GEX reductions
+  // (UPCXX_REDUCE_RING_MIN).
+  extern std::size_t reduce_ring_min;
+
+  // Default chunk size in bytes and number of chunks in flight for chunked
+  // transfers, see rma_chunked.hpp (UPCXX_RMA_CHUNK_SIZE, UPCXX_RMA_CHUNK_WINDOW).
+  extern std::size_t rma_chunk_size;
+  extern int rma_chunk_window;
+
+  // Append an eager packed command to the batch bound for `recipient`. Returns
+  // false if the command was not accepted, in which case the caller must send
+  // it itself.
+  bool rpc_aggr_append(
+    progress_level level,
+    intrank_t recipient,
+    void const *command_buf,
+    std::size_t buf_size,
+    std::size_t buf_align
+  );
+
+  // Send all non-empty batches. Must be called with the master persona.
+  void rpc_aggr_flush();
+
   struct bcast_payload_header;
   
   void bcast_am_master_eager(
@@ -575,6 +603,22 @@ namespace backend {
       );
   }
 
+  template<upcxx::progress_level level, typename Fn>
+  void send_am_master_aggr(intrank_t recipient, Fn &&fn) {
+    if(gasnet::rpc_aggr_size == 0) {
+      backend::send_am_master<level>(recipient, std::forward<Fn>(fn));
+      return;
+    }
+
+    // NPAM is disabled since an accepted command is copied into the batch
+    // instead of being committed as its own AM.
+    auto am = prepare_am<-1>(std::forward<Fn>(fn), recipient);
+
+    if(!(am.is_eager &&
+         gasnet::rpc_aggr_append(level, recipient, am.buffer, am.cmd_size, am.cmd_align)))
+      backend::send_prepared_am_master(level, recipient, am);
+  }
+
   template<typename AmBuf>
   void send_prepared_am_persona(
       upcxx::progress_level level,
@@ -695,8 +739,8 @@ namespace gasnet {
     #endif
   }
   
-  inline void register_cb(handle_cb *cb) {
-    get_handle_cb_queue().enqueue(cb);
+  inline void register_cb(handle_cb *cb, handle_cb_class cls = handle_cb_class::misc) {
+    get_handle_cb_queue().enqueue(cb, cls);
   }
   
   //////////////////////////////////////////////////////////////////////
@@ -764,7 +808,7 @@ namespace gasnet {
                                  (std::forward<AmFn>(am_fn), rank_d));
 
       void *buf_d_local = backend::localize_memory_nonnull(rank_d, reinterpret_cast<std::uintptr_t>(buf_d));
-      std::memcpy(buf_d_local, buf_s, buf_size);
+      backend::local_copy(buf_d_local, buf_s, buf_size);
       backend::send_prepared_am_master(am_level, rank_d, std::move(am));
       return rma_put_then_am_sync::op_now;
     }
@@ -30,6 +30,8 @@
 namespace upcxx {
 namespace backend {
 namespace gasnet {
+  class noise_log;
+  
   inline gex_TM_t handle_of(const upcxx::team &tm) {
     return reinterpret_cast<gex_TM_t>(tm.base(detail::internal_only()).handle);
   }
@@ -51,5 +53,32 @@ namespace gasnet {
     get_handle_cb_queue().enqueue(cb);
     return cb->pro.get_future();
   }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Node-aware collectives over world, see node_coll.cpp. Each node_coll_*
+  // returns false if the operation is not eligible, in which case the caller
+  // issues the flat GEX collective instead. Otherwise `cb` is registered as
+  // an already-satisfied handle once the operation completes on this rank.
+  
+  extern bool node_coll_enabled;
+  
+  void node_coll_init(noise_log &noise); // collective over world
+  void node_coll_finalize(); // collective over world
+  void node_coll_poll();
+  
+  bool node_coll_barrier(const upcxx::team &tm, handle_cb *cb);
+  bool node_coll_broadcast(
+    const upcxx::team &tm, intrank_t root, void *buf, std::size_t size,
+    handle_cb *cb
+  );
+  bool node_coll_reduce(
+    const upcxx::team &tm, intrank_t root_or_all,
+    const void *src, void *dst,
+    std::size_t elt_sz, std::size_t elt_n,
+    std::uintptr_t ty_id, std::uintptr_t op_id,
+    void(*op_vecfn)(const void*, void*, std::size_t, const void*),
+    void *op_data,
+    handle_cb *cb
+  );
 }}}
 #endif
@@ -293,7 +293,12 @@ namespace backend {
   
   template<progress_level level, typename Fn>
   void send_am_master(intrank_t recipient, Fn &&fn);
-  
+
+  // Same as send_am_master, but the message may be coalesced with others bound
+  // for the same rank when RPC aggregation is enabled.
+  template<progress_level level, typename Fn>
+  void send_am_master_aggr(intrank_t recipient, Fn &&fn);
+
   template<progress_level level, typename Fn>
   void send_am_persona(intrank_t recipient_rank, persona *recipient_persona, Fn &&fn);
 
@@ -312,6 +317,8 @@ namespace backend {
   
   void* localize_memory(intrank_t rank, std::uintptr_t raw);
   void* localize_memory_nonnull(intrank_t rank, std::uintptr_t raw);
+
+  void local_copy(void *buf_d, void const *buf_s, std::size_t size);
   
   std::tuple<intrank_t/*rank*/, std::uintptr_t/*raw*/> globalize_memory(void const *addr);
   std::tuple<intrank_t/*rank*/, std::uintptr_t/*raw*/> globalize_memory(void const *addr, std::tuple<intrank_t,std::uintptr_t> otherwise);
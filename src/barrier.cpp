@@ -127,7 +127,31 @@ void upcxx::barrier(const team &tm) {
   UPCXX_ASSERT_INIT();
   UPCXX_ASSERT_MASTER();
   UPCXX_ASSERT_COLLECTIVE_SAFE(entry_barrier::user);
+
+  if(backend::gasnet::rpc_aggr_size != 0)
+    backend::gasnet::rpc_aggr_flush();
  
+  if(backend::gasnet::node_coll_enabled) {
+    struct flag_cb final: backend::gasnet::handle_cb {
+      bool *done;
+      void execute_and_delete(backend::gasnet::handle_cb_successor) override {
+        *done = true;
+        delete this;
+      }
+    };
+    
+    bool done = false;
+    flag_cb *cb = new flag_cb;
+    cb->done = &done;
+    
+    if(backend::gasnet::node_coll_barrier(tm, cb)) {
+      while(!done)
+        upcxx::progress();
+      return;
+    }
+    delete cb;
+  }
+  
   // memory fencing is handled inside gex_Coll_BarrierNB + gex_Event_Test
   //std::atomic_thread_fence(std::memory_order_release);
   
@@ -145,10 +169,16 @@ void upcxx::detail::barrier_async_inject(
   ) {
   UPCXX_ASSERT_MASTER();
 
+  if(backend::gasnet::rpc_aggr_size != 0)
+    backend::gasnet::rpc_aggr_flush();
+
   #if 1
+    if(backend::gasnet::node_coll_barrier(tm, cb))
+      return;
+    
     gex_Event_t e = gex_Coll_BarrierNB(backend::gasnet::handle_of(tm), 0);
     cb->handle = reinterpret_cast<std::uintptr_t>(e);
-    backend::gasnet::register_cb(cb);
+    backend::gasnet::register_cb(cb, backend::gasnet::handle_cb_class::coll);
   #else
     // do hand-rolled barrier
     digest id = tm.next_collective_id(detail::internal_only());
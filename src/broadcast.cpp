@@ -14,6 +14,9 @@ void detail::broadcast_trivial(
   ) {
   UPCXX_ASSERT_MASTER();
   
+  if(gasnet::node_coll_broadcast(tm, root, buf, size, cb))
+    return;
+  
   gex_Event_t e = gex_Coll_BroadcastNB(
     gasnet::handle_of(tm),
     root,
@@ -23,6 +26,6 @@ void detail::broadcast_trivial(
   );
   
   cb->handle = reinterpret_cast<uintptr_t>(e);
-  gasnet::register_cb(cb);
+  gasnet::register_cb(cb, gasnet::handle_cb_class::coll);
   gasnet::after_gasnet();
 }
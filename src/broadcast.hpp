@@ -5,6 +5,16 @@
 #include <upcxx/completion.hpp>
 #include <upcxx/bind.hpp>
 #include <upcxx/team.hpp>
+#include <upcxx/view.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
 
 namespace upcxx {
   namespace detail {
@@ -26,6 +36,217 @@ namespace upcxx {
       template<typename Event>
       using tuple_t = std::tuple<>;
     };
+
+    // Serialized size beyond which broadcast_nontrivial streams the payload
+    // down the tree in segments of this size. Each segment message stays under
+    // the eager cutover so GASNet's AM buffers bound how much is in flight.
+    inline std::size_t broadcast_segment_size() {
+      constexpr std::size_t header_slack = 256;
+      std::size_t cutover = backend::gasnet::am_size_rdzv_cutover;
+      return cutover > 4*header_slack ? cutover - header_slack : 3*header_slack;
+    }
+
+    // Calls `fn(child, child_rank_d_ub)` for each of our children in the bcast
+    // tree covering team ranks [rank_me, rank_d_ub) modulo rank_n, the same
+    // shape bcast_am_master uses.
+    template<typename Fn>
+    void broadcast_tree_children(team const &tm, intrank_t rank_d_ub, Fn &&fn) {
+      intrank_t rank_me = tm.rank_me();
+      intrank_t rank_n = tm.rank_n();
+      
+      while(true) {
+        intrank_t rank_d_mid = rank_me + (rank_d_ub - rank_me)/2;
+        if(rank_d_mid == rank_me)
+          break;
+        
+        intrank_t translate = rank_n <= rank_d_mid ? rank_n : 0;
+        fn(tm[rank_d_mid - translate], rank_d_ub - translate);
+        
+        rank_d_ub = rank_d_mid;
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////
+    // broadcast_stream<T>: Sequence containers which broadcast_nontrivial
+    // sends as runs of elements. Receivers deserialize and append each run as
+    // it arrives, so no rank holds more than a few segments of the serialized
+    // payload besides the object itself.
+
+    template<typename T>
+    struct broadcast_stream: std::false_type {};
+
+    template<typename Seq, bool reservable>
+    struct broadcast_stream_seq: std::true_type {
+      using elt_type = typename Seq::value_type;
+      
+      static void reserve(Seq &seq, std::size_t n, std::true_type) { seq.reserve(n); }
+      static void reserve(Seq &seq, std::size_t n, std::false_type) {}
+      static void reserve(Seq &seq, std::size_t n) {
+        reserve(seq, n, std::integral_constant<bool, reservable>());
+      }
+    };
+
+    template<typename E, typename Alloc>
+    struct broadcast_stream<std::vector<E,Alloc>>:
+      broadcast_stream_seq<std::vector<E,Alloc>, /*reservable=*/true> {};
+    template<typename E, typename Alloc>
+    struct broadcast_stream<std::deque<E,Alloc>>:
+      broadcast_stream_seq<std::deque<E,Alloc>, /*reservable=*/false> {};
+    template<typename E, typename Alloc>
+    struct broadcast_stream<std::list<E,Alloc>>:
+      broadcast_stream_seq<std::list<E,Alloc>, /*reservable=*/false> {};
+    template<typename CharT, typename Traits, typename Alloc>
+    struct broadcast_stream<std::basic_string<CharT,Traits,Alloc>>:
+      broadcast_stream_seq<std::basic_string<CharT,Traits,Alloc>, /*reservable=*/true> {};
+
+    // a run which arrived ahead of its predecessors
+    struct broadcast_stream_early {
+      std::size_t ix, elt_n;
+      char *buf;
+    };
+
+    // Runs of elements are applied in order. GASNet doesn't order AMs, so a
+    // run arriving early is copied aside until the ones before it are in.
+    template<typename T, typename State>
+    struct broadcast_stream_fn {
+      using elt_type = typename broadcast_stream<T>::elt_type;
+      
+      void operator()(team_id tm_id, digest id, intrank_t rank_d_ub,
+                      std::size_t elt_n, std::size_t ix, std::size_t run_n,
+                      std::size_t align, view<char> bytes) const {
+        State *s = detail::template registered_state<State>(id);
+        
+        forward(tm_id.here(), id, rank_d_ub, elt_n, ix, run_n, align, bytes.begin(), bytes.size());
+        
+        if(s->stream_left == std::size_t(-1)) { // first run here
+          ::new(&s->value) T;
+          broadcast_stream<T>::reserve(s->value, elt_n);
+          s->stream_left = elt_n;
+        }
+        
+        if(ix != s->stream_next) {
+          char *buf = static_cast<char*>(detail::alloc_aligned(bytes.size(), align));
+          std::memcpy(buf, bytes.begin(), bytes.size());
+          s->stream_early.push_back(broadcast_stream_early{ix, run_n, buf});
+          return;
+        }
+        
+        char const *p = bytes.begin();
+        if(!detail::is_aligned(p, align)) {
+          if(s->stream_scratch_size < bytes.size()) {
+            std::free(s->stream_scratch);
+            s->stream_scratch = static_cast<char*>(detail::alloc_aligned(bytes.size(), serialization_align_max));
+            s->stream_scratch_size = bytes.size();
+          }
+          std::memcpy(s->stream_scratch, p, bytes.size());
+          p = s->stream_scratch;
+        }
+        apply(s, p, run_n);
+        
+        for(std::size_t i=0; i != s->stream_early.size();) {
+          broadcast_stream_early e = s->stream_early[i];
+          if(e.ix == s->stream_next) {
+            apply(s, e.buf, e.elt_n);
+            std::free(e.buf);
+            s->stream_early[i] = s->stream_early.back();
+            s->stream_early.pop_back();
+            i = 0;
+          }
+          else
+            i += 1;
+        }
+        
+        if(s->stream_left == 0) {
+          std::free(s->stream_scratch);
+          s->stream_scratch = nullptr;
+          backend::during_user([=]() { s->contribute(id); });
+        }
+      }
+
+      static void apply(State *s, char const *bytes, std::size_t run_n) {
+        detail::serialization_reader r(bytes);
+        r.template read_sequence_into_iterator<elt_type>(std::back_inserter(s->value), run_n);
+        s->stream_left -= run_n;
+        s->stream_next += 1;
+      }
+
+      static void forward(team const &tm, digest id, intrank_t rank_d_ub,
+                          std::size_t elt_n, std::size_t ix, std::size_t run_n,
+                          std::size_t align, char const *bytes, std::size_t n) {
+        detail::broadcast_tree_children(tm, rank_d_ub,
+          [&](intrank_t child, intrank_t child_d_ub) {
+            backend::send_am_master<progress_level::internal>(
+              child,
+              upcxx::bind(broadcast_stream_fn(),
+                tm.id(), id, child_d_ub, elt_n, ix, run_n, align,
+                upcxx::make_view(bytes, bytes + n, n)
+              )
+            );
+          }
+        );
+      }
+
+      // Root: serialize one run of elements at a time into a segment sized
+      // buffer and send it on before touching the next.
+      static void send(team const &tm, digest id, T const &value, std::size_t seg_size) {
+        using elt_ub_t = typename serialization_traits<elt_type>::static_ubound_t;
+        
+        // Stop adding elements once the next one might overflow the segment.
+        // Without a static bound on elements keep half a segment of headroom.
+        constexpr std::size_t elt_size = elt_ub_t::static_size;
+        constexpr std::size_t elt_align = elt_ub_t::static_align;
+        std::size_t fill = elt_ub_t::is_static
+          ? seg_size - std::min(seg_size, elt_align)
+          : seg_size/2;
+        
+        std::size_t elt_n = value.size();
+        char *buf = static_cast<char*>(detail::alloc_aligned(seg_size, serialization_align_max));
+        auto it = value.begin();
+        std::size_t ix = 0, sent_n = 0;
+        
+        // always at least one run so empty sequences still arrive
+        do {
+          detail::serialization_writer</*bounded=*/false> w(buf, seg_size);
+          std::size_t run_n = 0;
+          if(elt_ub_t::is_static) {
+            // fixed stride, so size the run up front and write it in bulk
+            std::size_t stride = (elt_size + elt_align-1) & -elt_align;
+            run_n = std::min<std::size_t>(elt_n - sent_n, std::max<std::size_t>(1, fill/stride));
+            auto it1 = std::next(it, run_n);
+            w.write_sequence(it, it1, run_n);
+            it = it1;
+          }
+          else {
+            while(it != value.end() && (run_n == 0 || w.size() <= fill)) {
+              w.write(*it);
+              ++it;
+              run_n += 1;
+            }
+          }
+          sent_n += run_n;
+          
+          // a lone element may have outgrown the segment
+          char *big = nullptr;
+          if(!w.contained_in_initial()) {
+            big = static_cast<char*>(detail::alloc_aligned(w.size(), w.align()));
+            w.compact_and_invalidate(big);
+          }
+          
+          forward(tm, id, tm.rank_me() + tm.rank_n(), elt_n, ix++, run_n, w.align(),
+                  big ? big : buf, w.size());
+          std::free(big);
+        } while(it != value.end());
+        
+        std::free(buf);
+      }
+    };
+
+    template<typename T, typename State>
+    void broadcast_stream_send(std::true_type, team const &tm, digest id, T const &value, std::size_t seg_size) {
+      broadcast_stream_fn<T,State>::send(tm, id, value, seg_size);
+    }
+    template<typename T, typename State>
+    void broadcast_stream_send(std::false_type, team const &tm, digest id, T const &value, std::size_t seg_size) {}
   }
   
   //////////////////////////////////////////////////////////////////////////////
@@ -71,8 +292,24 @@ namespace upcxx {
       int awaiting;
       union { T value; };
       union { cxs_state_t cxs_state; };
+      // reassembly of a segmented payload
+      char *seg_buf;
+      std::size_t seg_got;
+      // in-order application of a streamed one
+      std::size_t stream_next, stream_left;
+      char *stream_scratch;
+      std::size_t stream_scratch_size;
+      std::vector<detail::broadcast_stream_early> stream_early;
       
-      broadcast_state() { awaiting = 2; }
+      broadcast_state() {
+        awaiting = 2;
+        seg_buf = nullptr;
+        seg_got = 0;
+        stream_next = 0;
+        stream_left = std::size_t(-1);
+        stream_scratch = nullptr;
+        stream_scratch_size = 0;
+      }
       ~broadcast_state() {
         value.~T();
         cxs_state.~cxs_state_t();
@@ -87,21 +324,105 @@ namespace upcxx {
       }
     };
     
+    // Large payloads of types broadcast_stream doesn't cover are serialized
+    // whole and cut into segments which every rank forwards to its children
+    // in the bcast tree as soon as each arrives, at internal progress, so tree
+    // levels overlap instead of each rank waiting on the whole payload before
+    // sending it on. UPC++ readers need the complete image, so receivers
+    // reassemble and deserialize once the last segment lands.
+    struct segment_fn {
+      void operator()(team_id tm_id, digest id, intrank_t rank_d_ub,
+                      std::size_t size, std::size_t align, std::size_t offset,
+                      view<char> bytes) const {
+        broadcast_state *s = detail::template registered_state<broadcast_state>(id);
+        
+        if(s->seg_buf == nullptr)
+          s->seg_buf = static_cast<char*>(detail::alloc_aligned(size, align));
+        std::memcpy(s->seg_buf + offset, bytes.begin(), bytes.size());
+        
+        forward(tm_id.here(), id, rank_d_ub, size, align, offset, s->seg_buf + offset, bytes.size());
+        
+        s->seg_got += bytes.size();
+        if(s->seg_got == size) {
+          backend::during_user([=]() {
+            detail::serialization_reader r(s->seg_buf);
+            ::new(&s->value) T(r.template read<T>());
+            std::free(s->seg_buf);
+            s->contribute(id);
+          });
+        }
+      }
+
+      // Send a segment to our children.
+      static void forward(team const &tm, digest id, intrank_t rank_d_ub,
+                          std::size_t size, std::size_t align, std::size_t offset,
+                          char const *bytes, std::size_t n) {
+        detail::broadcast_tree_children(tm, rank_d_ub,
+          [&](intrank_t child, intrank_t child_d_ub) {
+            backend::send_am_master<progress_level::internal>(
+              child,
+              upcxx::bind(segment_fn(),
+                tm.id(), id, child_d_ub, size, align, offset,
+                upcxx::make_view(bytes, bytes + n, n)
+              )
+            );
+          }
+        );
+      }
+    };
+    
     digest id = const_cast<team*>(&tm)->next_collective_id(detail::internal_only());
 
     broadcast_state *s = detail::template registered_state<broadcast_state>(id);
 
     if(tm.rank_me() == root) {
-      backend::bcast_am_master<progress_level::user>(
-        tm,
-        upcxx::bind([=](T &&value) {
-            broadcast_state *s = detail::template registered_state<broadcast_state>(id);
-            ::new(&s->value) T(std::move(value));
-            s->contribute(id);
-          },
-          value
-        )
-      );
+      const std::size_t seg_size = detail::broadcast_segment_size();
+      
+      auto ubound = empty_storage_size.cat_ubound_of(value);
+      
+      if(decltype(ubound)::is_valid && ubound.size <= seg_size) {
+        backend::bcast_am_master<progress_level::user>(
+          tm,
+          upcxx::bind([=](T &&value) {
+              broadcast_state *s = detail::template registered_state<broadcast_state>(id);
+              ::new(&s->value) T(std::move(value));
+              s->contribute(id);
+            },
+            value
+          )
+        );
+      }
+      else if(detail::broadcast_stream<T>::value) {
+        detail::template broadcast_stream_send<T, broadcast_state>(
+          detail::broadcast_stream<T>(), tm, id, value, seg_size
+        );
+      }
+      else {
+        // Serialized once, small ones (including unbounded types like
+        // UPCXX_SERIALIZED_FIELDS) go out as a single segment.
+        alignas(serialization_align_max) char tiny[512];
+        detail::serialization_writer</*bounded=*/false> w(tiny, sizeof(tiny));
+        w.write(value);
+        
+        std::size_t size = w.size();
+        std::size_t align = w.align();
+        char *buf = tiny;
+        if(!w.contained_in_initial()) {
+          buf = static_cast<char*>(detail::alloc_aligned(size, align));
+          w.compact_and_invalidate(buf);
+        }
+        
+        // always at least one segment so empty payloads still arrive
+        std::size_t offset = 0;
+        do {
+          std::size_t n = std::min(seg_size, size - offset);
+          segment_fn::forward(tm, id, tm.rank_me() + tm.rank_n(), size, align, offset, buf + offset, n);
+          offset += n;
+        } while(offset < size);
+        
+        if(buf != tiny)
+          std::free(buf);
+      }
 
       ::new(&s->value) T(std::move(value));
       s->contribute(id);
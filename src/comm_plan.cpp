@@ -0,0 +1,200 @@
+#include <upcxx/comm_plan.hpp>
+#include <upcxx/backend/gasnet/runtime_internal.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace gasnet = upcxx::backend::gasnet;
+namespace detail = upcxx::detail;
+
+using upcxx::comm_plan;
+using detail::comm_plan_op;
+using detail::memvec_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// comm_plan
+
+comm_plan::~comm_plan() {
+  UPCXX_ASSERT_ALWAYS(!in_flight_, "comm_plan destroyed while a launch is in flight.");
+}
+
+comm_plan_op* comm_plan::add_op(comm_plan_op::kind_t kind, intrank_t rank) {
+  UPCXX_ASSERT_INIT();
+  UPCXX_ASSERT(!in_flight_, "comm_plan may not be modified while a launch is in flight");
+
+  ops_.emplace_back(new comm_plan_op(this, kind, rank));
+  return ops_.back().get();
+}
+
+void comm_plan::resolve(comm_plan_op *op, void *dest, void const *src) {
+  // A strided shape which coalesced to a single run is just contiguous.
+  if(op->levels == 0) {
+    if(op->kind == comm_plan_op::put_strided)
+      op->kind = comm_plan_op::put;
+    else if(op->kind == comm_plan_op::get_strided)
+      op->kind = comm_plan_op::get;
+  }
+
+  bool put = op->kind == comm_plan_op::put || op->kind == comm_plan_op::put_strided;
+
+  op->local = backend::rank_is_local(op->rank);
+  if(op->local) {
+    if(put)
+      dest = backend::localize_memory_nonnull(op->rank, reinterpret_cast<std::uintptr_t>(dest));
+    else
+      src = backend::localize_memory_nonnull(op->rank, reinterpret_cast<std::uintptr_t>(src));
+  }
+  op->dest = dest;
+  op->src = src;
+}
+
+void comm_plan::resolve_irregular(comm_plan_op *op) {
+  op->local = backend::rank_is_local(op->rank);
+  if(op->local) {
+    std::vector<memvec_t> &remote = op->kind == comm_plan_op::put_irreg
+      ? op->dest_vec
+      : op->src_vec;
+
+    for(memvec_t &v: remote)
+      v.gex_addr = backend::localize_memory_nonnull(op->rank, reinterpret_cast<std::uintptr_t>(v.gex_addr));
+  }
+}
+
+upcxx::future<> comm_plan::launch() {
+  UPCXX_ASSERT_INIT();
+  UPCXX_ASSERT_ALWAYS(!in_flight_, "comm_plan::launch() called while a previous launch is in flight.");
+
+  in_flight_ = true;
+  per_ = &upcxx::current_persona();
+  pro_ = promise<>();
+  future<> ans = pro_.get_future();
+
+  // Hold one count ourselves so transfers completing during issue can't
+  // finish the launch early.
+  pending_ = 1;
+
+  for(std::unique_ptr<comm_plan_op> &op: ops_) {
+    if(op->local)
+      op->copy_local();
+    else {
+      pending_ += 1;
+      op->issue();
+    }
+  }
+
+  if(--pending_ == 0)
+    finish();
+
+  return ans;
+}
+
+void comm_plan::transfer_done() {
+  // We are in gasnet's internal progress, move to the user progress of the
+  // launching persona.
+  if(--pending_ == 0)
+    per_->lpc_ff([this]() { this->finish(); });
+}
+
+void comm_plan::finish() {
+  // The transfers are all complete, a new launch may reuse them.
+  in_flight_ = false;
+
+  for(std::function<void(promise<>&)> &note: notes_)
+    note(pro_);
+
+  pro_.fulfill_anonymous(1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// comm_plan_op
+
+void comm_plan_op::execute_and_delete(gasnet::handle_cb_successor) {
+  this->next_ = reinterpret_cast<gasnet::handle_cb*>(0x1); // ready for reuse
+  plan->transfer_done();
+}
+
+void comm_plan_op::copy_local() {
+  switch(kind) {
+  case put:
+  case get:
+    backend::local_copy(dest, src, size);
+    break;
+
+  case put_strided:
+  case get_strided:
+    detail::rma_strided_copy_local(dest, dest_strides.data(), src, src_strides.data(),
+                                   size, count.data(), levels);
+    break;
+
+  case put_irreg:
+  case get_irreg: {
+      // walk both fragment lists, copying the overlap of the current pair
+      std::size_t si = 0, di = 0, soff = 0, doff = 0;
+      while(si < src_vec.size() && di < dest_vec.size()) {
+        std::size_t n = std::min(src_vec[si].gex_len - soff, dest_vec[di].gex_len - doff);
+        std::memcpy(static_cast<char*>(const_cast<void*>(dest_vec[di].gex_addr)) + doff,
+                    static_cast<char const*>(src_vec[si].gex_addr) + soff, n);
+        soff += n;
+        doff += n;
+        if(soff == src_vec[si].gex_len) { si += 1; soff = 0; }
+        if(doff == dest_vec[di].gex_len) { di += 1; doff = 0; }
+      }
+    } break;
+  }
+}
+
+void comm_plan_op::issue() {
+  UPCXX_ASSERT_MASTER_IFSEQ();
+
+  switch(kind) {
+  case put: {
+      gex_Event_t h = gex_RMA_PutNB(
+        gasnet::handle_of(upcxx::world()),
+        rank, dest, const_cast<void*>(src), size,
+        GEX_EVENT_DEFER,
+        /*flags*/0
+      );
+      this->handle = reinterpret_cast<uintptr_t>(h);
+      gasnet::register_cb(this, gasnet::handle_cb_class::rma_put);
+      gasnet::after_gasnet();
+    } break;
+
+  case get: {
+      gex_Event_t h = gex_RMA_GetNB(
+        gasnet::handle_of(upcxx::world()),
+        dest, rank, const_cast<void*>(src), size,
+        /*flags*/0
+      );
+      this->handle = reinterpret_cast<uintptr_t>(h);
+      gasnet::register_cb(this, gasnet::handle_cb_class::rma_get);
+      gasnet::after_gasnet();
+    } break;
+
+  case put_strided:
+    detail::rma_put_strided_nb(rank, dest, dest_strides.data(),
+                               src, src_strides.data(),
+                               size, count.data(), levels,
+                               /*source_cb*/nullptr, this);
+    break;
+
+  case get_strided:
+    detail::rma_get_strided_nb(dest, dest_strides.data(),
+                               rank, src, src_strides.data(),
+                               size, count.data(), levels,
+                               this);
+    break;
+
+  case put_irreg:
+    detail::rma_put_irreg_nb(rank, dest_vec.size(), dest_vec.data(),
+                             src_vec.size(), src_vec.data(),
+                             /*source_cb*/nullptr, this);
+    break;
+
+  case get_irreg:
+    detail::rma_get_irreg_nb(dest_vec.size(), dest_vec.data(),
+                             rank, src_vec.size(), src_vec.data(),
+                             this);
+    break;
+  }
+}
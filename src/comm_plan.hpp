@@ -0,0 +1,257 @@
+#ifndef _3b8e51c4_7f2a_4d06_a1e9_c4d52f08b713
+#define _3b8e51c4_7f2a_4d06_a1e9_c4d52f08b713
+
+#include <upcxx/backend.hpp>
+#include <upcxx/completion.hpp>
+#include <upcxx/future.hpp>
+#include <upcxx/global_ptr.hpp>
+#include <upcxx/rpc.hpp>
+#include <upcxx/vis.hpp>
+
+#include <upcxx/backend/gasnet/runtime.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+// comm_plan: A set of transfers and notifications recorded once and then
+// launched as a unit, typically every timestep of a halo exchange. Recording
+// does all of the argument checking, size computation, strided shape
+// coalescing and fragment list building, and resolves which targets live in
+// our local_team() (those are copied in place at launch, without gasnet).
+// Each recorded transfer owns the handle callback used to track it, so a
+// launch allocates nothing per transfer.
+
+namespace upcxx {
+  class comm_plan;
+
+  namespace detail {
+    struct comm_plan_op final: backend::gasnet::handle_cb {
+      enum kind_t: char {
+        put, get, put_strided, get_strided, put_irreg, get_irreg
+      };
+
+      comm_plan *plan;
+      kind_t kind;
+      bool local; // addresses below have been localized, copy in place
+      intrank_t rank; // of the remote side
+      void *dest;
+      void const *src;
+      std::size_t size; // bytes when contiguous, element size when strided
+
+      // strided
+      std::size_t levels;
+      std::vector<std::ptrdiff_t> src_strides, dest_strides;
+      std::vector<std::size_t> count;
+
+      // irregular
+      std::vector<memvec_t> src_vec, dest_vec;
+
+      comm_plan_op(comm_plan *plan, kind_t kind, intrank_t rank):
+        plan(plan), kind(kind), local(false), rank(rank),
+        dest(nullptr), src(nullptr), size(0), levels(0) {
+      }
+
+      void issue();
+      void copy_local();
+
+      // The op belongs to its plan and is reused by the next launch.
+      void execute_and_delete(backend::gasnet::handle_cb_successor) override;
+    };
+  }
+
+  class comm_plan {
+    friend struct detail::comm_plan_op;
+
+    std::vector<std::unique_ptr<detail::comm_plan_op>> ops_;
+    std::vector<std::function<void(promise<>&)>> notes_;
+
+    persona *per_ = nullptr;
+    promise<> pro_;
+    std::size_t pending_ = 0; // transfers of the current launch not yet complete
+    bool in_flight_ = false;
+
+    detail::comm_plan_op* add_op(detail::comm_plan_op::kind_t kind, intrank_t rank);
+    void transfer_done();
+    void finish();
+
+  public:
+    comm_plan() = default;
+    comm_plan(comm_plan const&) = delete;
+    comm_plan& operator=(comm_plan const&) = delete;
+    ~comm_plan();
+
+    // Contiguous transfers of `n` elements.
+    template<typename T>
+    void rput(T const *src, global_ptr<T> dest, std::size_t n) {
+      static_assert(is_trivially_serializable<T>::value,
+        "RMA operations only work on TriviallySerializable types.");
+      UPCXX_GPTR_CHK(dest);
+      UPCXX_ASSERT(src && dest, "pointer arguments to comm_plan::rput may not be null");
+
+      detail::comm_plan_op *op = add_op(detail::comm_plan_op::put, dest.rank_);
+      op->size = n*sizeof(T);
+      resolve(op, dest.raw_ptr_, src);
+    }
+
+    template<typename T>
+    void rget(global_ptr<const T> src, T *dest, std::size_t n) {
+      static_assert(is_trivially_serializable<T>::value,
+        "RMA operations only work on TriviallySerializable types.");
+      UPCXX_GPTR_CHK(src);
+      UPCXX_ASSERT(src && dest, "pointer arguments to comm_plan::rget may not be null");
+
+      detail::comm_plan_op *op = add_op(detail::comm_plan_op::get, src.rank_);
+      op->size = n*sizeof(T);
+      resolve(op, dest, src.raw_ptr_);
+    }
+
+    // Strided transfers of the shape `shape` (see strided_plan), which is
+    // copied into the plan.
+    template<typename T, std::size_t Dim>
+    void rput(strided_plan<T,Dim> const &shape, T const *src_base, global_ptr<T> dest_base) {
+      UPCXX_GPTR_CHK(dest_base);
+      UPCXX_ASSERT(src_base && dest_base, "pointer arguments to comm_plan::rput may not be null");
+
+      detail::comm_plan_op *op = add_op(detail::comm_plan_op::put_strided, dest_base.rank_);
+      set_shape(op, shape);
+      resolve(op,
+        reinterpret_cast<char*>(dest_base.raw_ptr_) + shape.dest_offset_,
+        reinterpret_cast<char const*>(src_base) + shape.src_offset_);
+    }
+
+    template<typename T, std::size_t Dim>
+    void rget(strided_plan<T,Dim> const &shape, global_ptr<const T> src_base, T *dest_base) {
+      UPCXX_GPTR_CHK(src_base);
+      UPCXX_ASSERT(src_base && dest_base, "pointer arguments to comm_plan::rget may not be null");
+
+      detail::comm_plan_op *op = add_op(detail::comm_plan_op::get_strided, src_base.rank_);
+      set_shape(op, shape);
+      resolve(op,
+        reinterpret_cast<char*>(dest_base) + shape.dest_offset_,
+        reinterpret_cast<char const*>(src_base.raw_ptr_) + shape.src_offset_);
+    }
+
+    // Irregular transfers, same iterator requirements as rput_irregular and
+    // rget_irregular. The fragment lists are built here, once.
+    template<typename SrcIter, typename DestIter>
+    void rput_irregular(SrcIter src_runs_begin, SrcIter src_runs_end,
+                        DestIter dst_runs_begin, DestIter dst_runs_end) {
+      using T = typename std::tuple_element<0,typename std::iterator_traits<DestIter>::value_type>::type::element_type;
+      static_assert(is_trivially_serializable<T>::value,
+        "RMA operations only work on TriviallySerializable types.");
+
+      intrank_t rank_d = upcxx::rank_me(); // default for empty sequence is self
+      if(!(dst_runs_begin == dst_runs_end))
+        rank_d = std::get<0>(*dst_runs_begin).rank_;
+
+      detail::comm_plan_op *op = add_op(detail::comm_plan_op::put_irreg, rank_d);
+
+      std::size_t dstsize = 0, srcsize = 0;
+      for(DestIter d=dst_runs_begin; !(d==dst_runs_end); ++d) {
+        UPCXX_GPTR_CHK(std::get<0>(*d));
+        UPCXX_ASSERT(std::get<0>(*d), "pointer arguments to comm_plan::rput_irregular may not be null");
+        UPCXX_ASSERT(rank_d == std::get<0>(*d).rank_,
+          "pointer arguments to comm_plan::rput_irregular must all target the same affinity");
+        detail::memvec_t v;
+        v.gex_addr = std::get<0>(*d).raw_ptr_;
+        v.gex_len = std::get<1>(*d)*sizeof(T);
+        dstsize += v.gex_len;
+        op->dest_vec.push_back(v);
+      }
+      for(SrcIter s=src_runs_begin; !(s==src_runs_end); ++s) {
+        UPCXX_ASSERT(std::get<0>(*s), "pointer arguments to comm_plan::rput_irregular may not be null");
+        detail::memvec_t v;
+        v.gex_addr = std::get<0>(*s);
+        v.gex_len = std::get<1>(*s)*sizeof(T);
+        srcsize += v.gex_len;
+        op->src_vec.push_back(v);
+      }
+      UPCXX_ASSERT(dstsize == srcsize,
+        "comm_plan::rput_irregular: destination size (" << dstsize << " bytes) does not match source size (" << srcsize << " bytes)");
+
+      resolve_irregular(op);
+    }
+
+    template<typename SrcIter, typename DestIter>
+    void rget_irregular(SrcIter src_runs_begin, SrcIter src_runs_end,
+                        DestIter dst_runs_begin, DestIter dst_runs_end) {
+      using U = typename std::tuple_element<0,typename std::iterator_traits<SrcIter>::value_type>::type::element_type;
+      using T = typename std::remove_const<U>::type;
+      static_assert(is_trivially_serializable<T>::value,
+        "RMA operations only work on TriviallySerializable types.");
+
+      intrank_t rank_s = upcxx::rank_me(); // default for empty sequence is self
+      if(!(src_runs_begin == src_runs_end))
+        rank_s = std::get<0>(*src_runs_begin).rank_;
+
+      detail::comm_plan_op *op = add_op(detail::comm_plan_op::get_irreg, rank_s);
+
+      std::size_t dstsize = 0, srcsize = 0;
+      for(DestIter d=dst_runs_begin; !(d==dst_runs_end); ++d) {
+        UPCXX_ASSERT(std::get<0>(*d), "pointer arguments to comm_plan::rget_irregular may not be null");
+        detail::memvec_t v;
+        v.gex_addr = std::get<0>(*d);
+        v.gex_len = std::get<1>(*d)*sizeof(T);
+        dstsize += v.gex_len;
+        op->dest_vec.push_back(v);
+      }
+      for(SrcIter s=src_runs_begin; !(s==src_runs_end); ++s) {
+        UPCXX_GPTR_CHK(std::get<0>(*s));
+        UPCXX_ASSERT(std::get<0>(*s), "pointer arguments to comm_plan::rget_irregular may not be null");
+        UPCXX_ASSERT(rank_s == std::get<0>(*s).rank_,
+          "pointer arguments to comm_plan::rget_irregular must all target the same affinity");
+        detail::memvec_t v;
+        v.gex_addr = std::get<0>(*s).raw_ptr_;
+        v.gex_len = std::get<1>(*s)*sizeof(T);
+        srcsize += v.gex_len;
+        op->src_vec.push_back(v);
+      }
+      UPCXX_ASSERT(dstsize == srcsize,
+        "comm_plan::rget_irregular: destination size (" << dstsize << " bytes) does not match source size (" << srcsize << " bytes)");
+
+      resolve_irregular(op);
+    }
+
+    // Run `fn` on `recipient` once every transfer of a launch has completed,
+    // as with rpc(recipient, fn). The launch's future also waits for `fn` to
+    // have executed. `fn` is sent anew by each launch.
+    template<typename Fn>
+    void notify(intrank_t recipient, Fn fn) {
+      UPCXX_ASSERT(recipient >= 0 && recipient < world().rank_n(),
+        "comm_plan::notify(recipient, ...) requires recipient in [0, rank_n()-1] == [0, " << world().rank_n()-1 << "], but given: " << recipient);
+      UPCXX_ASSERT(!in_flight_, "comm_plan may not be modified while a launch is in flight");
+
+      notes_.push_back([=](promise<> &pro) {
+        upcxx::rpc(recipient, operation_cx::as_promise(pro), fn);
+      });
+    }
+
+    // Issue everything recorded. At most one launch may be in flight, and
+    // the plan must outlive it. The buffers named by the plan are subject
+    // to the same rules as for the individual operations until the returned
+    // future is ready.
+    UPCXX_NODISCARD
+    future<> launch();
+
+    // Number of recorded transfers.
+    std::size_t size() const { return ops_.size(); }
+
+  private:
+    void resolve(detail::comm_plan_op *op, void *dest, void const *src);
+    void resolve_irregular(detail::comm_plan_op *op);
+
+    template<typename T, std::size_t Dim>
+    static void set_shape(detail::comm_plan_op *op, strided_plan<T,Dim> const &shape) {
+      op->size = shape.elemsz_;
+      op->levels = shape.levels_;
+      op->src_strides.assign(shape.src_strides_, shape.src_strides_ + shape.levels_);
+      op->dest_strides.assign(shape.dest_strides_, shape.dest_strides_ + shape.levels_);
+      op->count.assign(shape.count_, shape.count_ + shape.levels_);
+    }
+  };
+}
+#endif
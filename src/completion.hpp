@@ -8,6 +8,7 @@
 #include <upcxx/persona.hpp>
 #include <upcxx/utility.hpp>
 
+#include <cstdint>
 #include <tuple>
 
 namespace upcxx {
@@ -105,6 +106,20 @@ namespace upcxx {
     
     Fn fn_;
   };
+
+  // Counter completion: once the event occurs, atomically add delta_ to the
+  // 64-bit counter at (rank_, addr_) through the gasnet atomic domain ad_.
+  // See "./notify_counter.hpp".
+  template<typename Event>
+  struct counter_cx {
+    using event_t = Event;
+    using deserialized_cx = counter_cx<Event>;
+
+    std::uintptr_t ad_;
+    intrank_t rank_;
+    std::uint64_t *addr_;
+    std::uint64_t delta_;
+  };
   
   //////////////////////////////////////////////////////////////////////////////
   /* completions<...>: A list of completion actions. We use lisp-like lists where
@@ -378,6 +393,20 @@ namespace upcxx {
         };
       }
     };
+
+    // remote_cx::as_counter(ctr, where, delta): a notification which lands in
+    // the target's memory without running anything there. It is a local
+    // action tied to operation completion that issues the increment, so a
+    // target observing its counter at N knows N notified operations have
+    // completed. `Counter` is notify_counter, templated only to break the
+    // include cycle.
+    struct support_as_counter {
+      template<typename Counter, typename Where>
+      static completions<counter_cx<operation_cx_event>>
+      as_counter(Counter const &ctr, Where const &where, std::uint64_t delta = 1) {
+        return {ctr.counter_cx_for(where, delta)};
+      }
+    };
   }
 
   struct source_cx:
@@ -394,7 +423,8 @@ namespace upcxx {
     detail::support_as_promise<operation_cx_event> {};
   
   struct remote_cx:
-    detail::support_as_rpc<remote_cx_event> {};
+    detail::support_as_rpc<remote_cx_event>,
+    detail::support_as_counter {};
 
   //////////////////////////////////////////////////////////////////////
   // cx_non_future_return, cx_result_combine, and cx_remote_dispatch:
@@ -715,6 +745,34 @@ namespace upcxx {
       }
     };
 
+    // Issues the increment of a counter_cx, defined in notify_counter.cpp.
+    void counter_cx_fire(std::uintptr_t ad, intrank_t rank,
+                         std::uint64_t *addr, std::uint64_t delta);
+
+    template<typename Event, typename ...T>
+    struct cx_state<counter_cx<Event>, std::tuple<T...>> {
+      counter_cx<Event> cx_;
+
+      cx_state(counter_cx<Event> cx):
+        cx_(cx) {
+      }
+
+      lpc_dormant<T...>* to_lpc_dormant(lpc_dormant<T...> *tail) && {
+        counter_cx<Event> cx = cx_;
+        return detail::make_lpc_dormant<T...>(
+          upcxx::current_persona(), progress_level::user,
+          [=](T&&...) {
+            detail::counter_cx_fire(cx.ad_, cx.rank_, cx.addr_, cx.delta_);
+          },
+          tail
+        );
+      }
+
+      void operator()(T...) {
+        detail::counter_cx_fire(cx_.ad_, cx_.rank_, cx_.addr_, cx_.delta_);
+      }
+    };
+
     // cx_state<rpc_cx<...>> does not fit the usual mold since the event isn't
     // triggered locally. Instead, fn_ is extracted and sent over the wire by
     // completions_state<...>::bind_event().
@@ -123,7 +123,8 @@ void upcxx::detail::rma_copy_remote(
   }
 
   cb->handle = reinterpret_cast<uintptr_t>(h);
-  gasnet::register_cb(cb);
+  gasnet::register_cb(cb, isput ? gasnet::handle_cb_class::rma_put
+                                : gasnet::handle_cb_class::rma_get);
   gasnet::after_gasnet();
 #else // !UPCXX_CUDA_USE_MK
     UPCXX_FATAL_ERROR("Internal error in upcxx::copy()");
@@ -143,7 +144,7 @@ void upcxx::detail::rma_copy_get(
     /*flags*/0
   );
   cb->handle = reinterpret_cast<uintptr_t>(h);
-  gasnet::register_cb(cb);
+  gasnet::register_cb(cb, gasnet::handle_cb_class::rma_get);
   gasnet::after_gasnet();
 }
 
@@ -161,6 +162,6 @@ void upcxx::detail::rma_copy_put(
     /*flags*/0
   );
   cb->handle = reinterpret_cast<uintptr_t>(h);
-  gasnet::register_cb(cb);
+  gasnet::register_cb(cb, gasnet::handle_cb_class::rma_put);
   gasnet::after_gasnet();
 }
@@ -134,6 +134,23 @@ namespace upcxx {
       CxsDecayed>;
     using copy_traits = detail::copy_traits<Cxs>;
 
+    // Shared-memory bypass: both ends are host memory we can address
+    // directly, so copy in place and complete synchronously.
+    if(!copy_traits::want_remote &&
+       (heap_s == private_heap || (heap_s == host_heap && backend::rank_is_local(rank_s))) &&
+       (heap_d == private_heap || (heap_d == host_heap && backend::rank_is_local(rank_d)))) {
+      void const *local_s = heap_s == private_heap ? buf_s
+        : backend::localize_memory_nonnull(rank_s, reinterpret_cast<std::uintptr_t>(buf_s));
+      void *local_d = heap_d == private_heap ? buf_d
+        : backend::localize_memory_nonnull(rank_d, reinterpret_cast<std::uintptr_t>(buf_d));
+
+      UPCXX_ASSERT((char*)local_d + size <= local_s || (char const*)local_s + size <= local_d,
+                   "Source and destination regions in upcxx::copy must not overlap");
+      return detail::template rma_put_local<detail::rput_event_values>(
+        local_d, local_s, size, std::forward<Cxs>(cxs)
+      );
+    }
+
     cxs_here_t *cxs_here = new cxs_here_t(std::forward<Cxs>(cxs));
     cxs_remote_t cxs_remote(std::forward<Cxs>(cxs));
 
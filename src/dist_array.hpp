@@ -0,0 +1,218 @@
+#ifndef _678a6fcf_0f81_4420_b7c8_ae74b809ca14
+#define _678a6fcf_0f81_4420_b7c8_ae74b809ca14
+
+#include <upcxx/allocate.hpp>
+#include <upcxx/backend.hpp>
+#include <upcxx/future.hpp>
+#include <upcxx/global_ptr.hpp>
+#include <upcxx/reduce.hpp>
+#include <upcxx/rget.hpp>
+#include <upcxx/rput.hpp>
+#include <upcxx/team.hpp>
+#include <upcxx/vis.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace upcxx {
+  //////////////////////////////////////////////////////////////////////////////
+  // dist_array: `n` elements of T spread over the ranks of a team in blocks
+  // of `block` elements dealt round-robin, so block `b` lives on team rank
+  // `b % rank_n`. The default block is `ceil(n/rank_n)`, giving the plain
+  // block layout with one block per rank. A rank's blocks are stored
+  // contiguously in its shared segment, in order, so:
+  //
+  //  - local_data() and local_size() expose this rank's portion as one
+  //    array for owner-computes loops.
+  //  - The elements of a global range [lo,hi) owned by one rank are
+  //    contiguous on that rank, so get() and put() issue a single
+  //    rget/rput per owner, scattering or gathering on this side.
+  //
+  // Every member's base pointer is exchanged once at construction, after
+  // which translating an index to a global_ptr is arithmetic. Construction
+  // and destroy() are collective over the team. T must be
+  // TriviallySerializable and default constructible.
+
+  template<typename T>
+  class dist_array {
+    const upcxx::team *tm_;
+    std::size_t n_;
+    std::size_t block_;
+    std::vector<global_ptr<T>> bases_; // by team rank
+    std::size_t local_n_;
+
+    // Call `xfer(remote, runs, n)` once per rank owning part of [lo,hi),
+    // with the `n` elements it owns there starting at `remote`, and the
+    // matching (pointer, length) runs of the buffer `buf` holding [lo,hi).
+    template<typename U, typename Xfer>
+    void for_each_owner(std::size_t lo, std::size_t hi, U *buf, Xfer &&xfer) const {
+      std::size_t p = bases_.size();
+      std::size_t b0 = lo/block_, b1 = (hi-1)/block_;
+      std::vector<std::pair<U*, std::size_t>> runs;
+
+      for(std::size_t s = b0; s <= b1 && s < b0 + p; s++) {
+        runs.clear();
+        std::size_t n = 0;
+        for(std::size_t b = s; b <= b1; b += p) {
+          std::size_t a = std::max(lo, b*block_);
+          std::size_t z = std::min(hi, (b+1)*block_);
+          runs.push_back({buf + (a - lo), z - a});
+          n += z - a;
+        }
+        xfer(pointer_to(std::max(lo, s*block_)), runs, n);
+      }
+    }
+
+  public:
+    explicit dist_array(std::size_t n, const upcxx::team &tm = upcxx::world()):
+      dist_array(n, std::max<std::size_t>(1, (n + tm.rank_n()-1)/tm.rank_n()), tm) {
+    }
+
+    dist_array(std::size_t n, std::size_t block, const upcxx::team &tm = upcxx::world()):
+      tm_(&tm),
+      n_(n),
+      block_(block),
+      bases_(tm.rank_n()) {
+      UPCXX_ASSERT_INIT();
+      UPCXX_ASSERT_MASTER();
+      UPCXX_ASSERT_ALWAYS(block >= 1, "dist_array: block must be at least 1");
+
+      static_assert(is_trivially_serializable<T>::value,
+        "dist_array<T> requires T to be TriviallySerializable.");
+
+      std::size_t p = tm.rank_n();
+      std::size_t me = tm.rank_me();
+      std::size_t blocks = (n + block - 1)/block;
+      std::size_t mine = blocks > me ? (blocks - me + p-1)/p : 0;
+      local_n_ = mine*block;
+      if(mine != 0 && (blocks-1) % p == me)
+        local_n_ -= blocks*block - n; // the last block is short
+
+      global_ptr<T> base = upcxx::new_array<T>(std::max<std::size_t>(1, local_n_));
+
+      // allgather the base pointers: everyone contributes null except in its
+      // own slot
+      std::vector<global_ptr<T>> contrib(p);
+      contrib[me] = base;
+      upcxx::reduce_all(contrib.data(), bases_.data(), p,
+        [](global_ptr<T> a, global_ptr<T> b) { return a ? a : b; },
+        tm
+      ).wait();
+    }
+
+    dist_array(dist_array const&) = delete;
+    dist_array(dist_array&&) = default;
+
+    ~dist_array() {
+      if(backend::init_count > 0) { // we don't assert on leaks after finalization
+        UPCXX_ASSERT_ALWAYS(
+          bases_.empty(),
+          "ERROR: `upcxx::dist_array::destroy()` must be called collectively before destructor."
+        );
+      }
+    }
+
+    // Collective. No transfers against the array may be in flight.
+    void destroy(entry_barrier eb = entry_barrier::user) {
+      UPCXX_ASSERT_INIT();
+      UPCXX_ASSERT_MASTER();
+      UPCXX_ASSERT_COLLECTIVE_SAFE(eb);
+      backend::quiesce(*tm_, eb);
+      upcxx::delete_array(bases_[tm_->rank_me()]);
+      bases_.clear();
+    }
+
+    upcxx::team& team() { return *const_cast<upcxx::team*>(tm_); }
+    const upcxx::team& team() const { return *tm_; }
+
+    std::size_t size() const { return n_; }
+    std::size_t block() const { return block_; }
+
+    // Team rank owning element `i`.
+    intrank_t owner(std::size_t i) const {
+      return intrank_t((i/block_) % bases_.size());
+    }
+
+    // Position of element `i` within its owner's local portion.
+    std::size_t local_offset(std::size_t i) const {
+      return (i/block_/bases_.size())*block_ + i%block_;
+    }
+
+    global_ptr<T> pointer_to(std::size_t i) const {
+      UPCXX_ASSERT(i < n_, "dist_array index " << i << " out of range [0," << n_ << ")");
+      return bases_[owner(i)] + local_offset(i);
+    }
+
+    // This rank's elements, in global index order.
+    T* local_data() const {
+      return bases_[tm_->rank_me()].local();
+    }
+    std::size_t local_size() const { return local_n_; }
+
+    // Global index of the element at `local_data()[k]`.
+    std::size_t global_index(std::size_t k) const {
+      return ((k/block_)*bases_.size() + tm_->rank_me())*block_ + k%block_;
+    }
+
+    // Call `fn(i, x)` for every local element `x` with global index `i`.
+    template<typename Fn>
+    void for_each_local(Fn &&fn) const {
+      T *data = local_data();
+      std::size_t i = global_index(0);
+      std::size_t stride = (bases_.size()-1)*block_;
+
+      for(std::size_t k=0; k < local_n_; k += block_, i += stride) {
+        std::size_t kn = std::min(local_n_, k + block_);
+        for(std::size_t j=k; j < kn; j++)
+          fn(i++, data[j]);
+      }
+    }
+
+    // Copy elements [lo,hi) into `dst`.
+    future<> get(std::size_t lo, std::size_t hi, T *dst) const {
+      UPCXX_ASSERT_INIT();
+      UPCXX_ASSERT(lo <= hi && hi <= n_, "dist_array::get range [" << lo << "," << hi << ") out of range [0," << n_ << ")");
+      if(lo == hi)
+        return make_future();
+
+      promise<> all;
+      for_each_owner(lo, hi, dst,
+        [&](global_ptr<T> src, std::vector<std::pair<T*, std::size_t>> const &runs, std::size_t n) {
+          if(runs.size() == 1)
+            upcxx::rget(src, runs[0].first, n, operation_cx::as_promise(all));
+          else {
+            std::pair<global_ptr<T>, std::size_t> whole{src, n};
+            upcxx::rget_irregular(&whole, &whole + 1, runs.begin(), runs.end(),
+                                  operation_cx::as_promise(all));
+          }
+        }
+      );
+      return all.finalize();
+    }
+
+    // Copy `src` into elements [lo,hi).
+    future<> put(T const *src, std::size_t lo, std::size_t hi) const {
+      UPCXX_ASSERT_INIT();
+      UPCXX_ASSERT(lo <= hi && hi <= n_, "dist_array::put range [" << lo << "," << hi << ") out of range [0," << n_ << ")");
+      if(lo == hi)
+        return make_future();
+
+      promise<> all;
+      for_each_owner(lo, hi, src,
+        [&](global_ptr<T> dst, std::vector<std::pair<T const*, std::size_t>> const &runs, std::size_t n) {
+          if(runs.size() == 1)
+            upcxx::rput(runs[0].first, dst, n, operation_cx::as_promise(all));
+          else {
+            std::pair<global_ptr<T>, std::size_t> whole{dst, n};
+            upcxx::rput_irregular(runs.begin(), runs.end(), &whole, &whole + 1,
+                                  operation_cx::as_promise(all));
+          }
+        }
+      );
+      return all.finalize();
+    }
+  };
+}
+#endif
@@ -27,16 +27,29 @@ namespace upcxx {
   //private:
     digest dig_;
     
+    // The promise for this id: straight from its slot when the object is
+    // live and owns one, otherwise from (or inserted into) the registry.
+    detail::future_header_promise<dist_object<T>&>* promise_() const {
+      UPCXX_ASSERT_MASTER();
+      detail::dist_slot &slot = detail::dist_slot_of(dig_);
+      if(slot.promise != nullptr && slot.id == dig_)
+        return static_cast<detail::future_header_promise<dist_object<T>&>*>(slot.promise);
+      else
+        return detail::registered_promise<dist_object<T>&>(dig_);
+    }
+    
   //public:
     dist_object<T>& here() const {
       UPCXX_ASSERT_INIT();
-      UPCXX_ASSERT(detail::registry[dig_],
+      UPCXX_ASSERT(
+        (detail::dist_slot_of(dig_).promise != nullptr && detail::dist_slot_of(dig_).id == dig_) ||
+        detail::registry[dig_],
         "dist_id::here() called for an invalid id or dist_object (possibly outside its lifetime)");
       return std::get<0>(
         // 3. retrieve results tuple
         detail::future_header_result<dist_object<T>&>::results_of(
           // 1. get future_header_promise<...>* for this digest
-          &detail::registered_promise<dist_object<T>&>(dig_)
+          &promise_()
             // 2. cast to future_header* (not using inheritnace, must use embedded first member)
             ->base_header_result.base_header
         )
@@ -45,7 +58,7 @@ namespace upcxx {
     
     future<dist_object<T>&> when_here() const {
       UPCXX_ASSERT_INIT();
-      return detail::promise_get_future(detail::registered_promise<dist_object<T>&>(dig_));
+      return detail::promise_get_future(promise_());
     }
     
     #define UPCXX_COMPARATOR(op) \
@@ -85,6 +98,23 @@ namespace upcxx {
     digest id_;
     T value_;
     
+    // Publish this object under `id_`: the registry entry is authoritative,
+    // the slot is claimed only if no other live object holds it.
+    void register_() {
+      detail::future_header_promise<dist_object<T>&> *pro =
+        detail::registered_promise<dist_object<T>&>(id_);
+      
+      detail::dist_slot &slot = detail::dist_slot_of(id_);
+      if(slot.promise == nullptr)
+        slot = detail::dist_slot{id_, pro};
+      
+      backend::fulfill_during<progress_level::user>(
+          pro->incref(1),
+          std::tuple<dist_object<T>&>(*this),
+          backend::master
+        );
+    }
+    
   public:
     template<typename ...U>
     dist_object(const upcxx::team &tm, U &&...arg):
@@ -96,11 +126,7 @@ namespace upcxx {
       
       id_ = const_cast<upcxx::team*>(&tm)->next_collective_id(detail::internal_only());
       
-      backend::fulfill_during<progress_level::user>(
-          detail::registered_promise<dist_object<T>&>(id_)->incref(1),
-          std::tuple<dist_object<T>&>(*this),
-          backend::master
-        );
+      register_();
     }
     
     dist_object(T value, const upcxx::team &tm):
@@ -112,11 +138,7 @@ namespace upcxx {
 
       id_ = const_cast<upcxx::team*>(&tm)->next_collective_id(detail::internal_only());
       
-      backend::fulfill_during<progress_level::user>(
-          detail::registered_promise<dist_object<T>&>(id_)->incref(1),
-          std::tuple<dist_object<T>&>(*this),
-          backend::master
-        );
+      register_();
     }
     
     dist_object(T value):
@@ -151,6 +173,10 @@ namespace upcxx {
       if (backend::init_count > 0) UPCXX_ASSERT_MASTER();
 
       if(id_ != digest{~0ull, ~0ull}) {
+        detail::dist_slot &slot = detail::dist_slot_of(id_);
+        if(slot.promise != nullptr && slot.id == id_)
+          slot = detail::dist_slot{digest::zero(), nullptr};
+        
         auto it = detail::registry.find(id_);
         static_cast<detail::future_header_promise<dist_object<T>&>*>(it->second)->dropref();
         detail::registry.erase(it);
@@ -182,7 +208,9 @@ namespace upcxx {
 ////////////////////////////////////////////////////////////////////////
 
 namespace upcxx {
-  // dist_object<T> references are bound using their id's.
+  // dist_object<T> references are bound using their id's. Whether the object
+  // is here yet is only known at runtime, so `immediate` stays false; a ready
+  // future then runs the bound callable inline (see future_impl_then_lazy).
   template<typename T>
   struct binding<dist_object<T>&> {
     using on_wire_type = dist_id<T>;
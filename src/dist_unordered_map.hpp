@@ -0,0 +1,340 @@
+#ifndef _31683fbf_9997_4f83_9d40_83f6b2d273ba
+#define _31683fbf_9997_4f83_9d40_83f6b2d273ba
+
+#include <upcxx/backend.hpp>
+#include <upcxx/dist_object.hpp>
+#include <upcxx/future.hpp>
+#include <upcxx/rpc.hpp>
+#include <upcxx/team.hpp>
+#include <upcxx/view.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace upcxx {
+  namespace detail {
+    // splitmix64 finalizer: spreads whatever the user's hash gives us (often
+    // the identity for integers) over all 64 bits, so the owner rank, table
+    // slot and tag can each take their own bits.
+    inline std::uint64_t dmap_mix(std::uint64_t h) {
+      h ^= h >> 30; h *= 0xbf58476d1ce4e5b9ull;
+      h ^= h >> 27; h *= 0x94d049bb133111ebull;
+      h ^= h >> 31;
+      return h;
+    }
+
+    enum class dmap_op: char { insert, update, find };
+
+    // The owner-side table of a dist_unordered_map: open addressing with
+    // linear probing over separate control, key and value arrays. A probe
+    // scans the one-byte control array, only touching a key when its 7-bit
+    // hash tag matches, and only touching the value on a hit. There is no
+    // erase, so no tombstones. K and V must be default constructible.
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Combine>
+    class dmap_table {
+      std::vector<std::uint8_t> ctrl_; // 0 when empty, otherwise 0x80 | hash tag
+      std::vector<K> keys_;
+      std::vector<V> vals_;
+      std::size_t size_ = 0;
+
+      static std::uint8_t tag_of(std::uint64_t h) {
+        return 0x80 | std::uint8_t(h >> 25);
+      }
+
+      // The slot holding `k`, or the empty slot where it belongs.
+      std::size_t probe(K const &k, std::uint64_t h) const {
+        std::size_t mask = ctrl_.size() - 1;
+        std::uint8_t tag = tag_of(h);
+        std::size_t i = h & mask;
+        while(ctrl_[i] != 0 && !(ctrl_[i] == tag && KeyEqual()(keys_[i], k)))
+          i = (i + 1) & mask;
+        return i;
+      }
+
+      template<typename V1>
+      void place(std::size_t i, std::uint64_t h, K const &k, V1 &&v) {
+        ctrl_[i] = tag_of(h);
+        keys_[i] = k;
+        vals_[i] = std::forward<V1>(v);
+        if(4*++size_ > 3*ctrl_.size())
+          grow();
+      }
+
+      void grow() {
+        std::vector<std::uint8_t> ctrl(2*ctrl_.size(), 0);
+        std::vector<K> keys(ctrl.size());
+        std::vector<V> vals(ctrl.size());
+        std::swap(ctrl, ctrl_);
+        std::swap(keys, keys_);
+        std::swap(vals, vals_);
+
+        for(std::size_t j=0; j < ctrl.size(); j++) {
+          if(ctrl[j] != 0) {
+            std::size_t i = probe(keys[j], hash_of(keys[j]));
+            ctrl_[i] = ctrl[j];
+            keys_[i] = std::move(keys[j]);
+            vals_[i] = std::move(vals[j]);
+          }
+        }
+      }
+
+    public:
+      dmap_table():
+        ctrl_(16, 0), keys_(16), vals_(16) {
+      }
+
+      static std::uint64_t hash_of(K const &k) {
+        return dmap_mix(std::uint64_t(Hash()(k)));
+      }
+
+      std::size_t size() const { return size_; }
+
+      V const* find(K const &k) const {
+        std::size_t i = probe(k, hash_of(k));
+        return ctrl_[i] != 0 ? &vals_[i] : nullptr;
+      }
+
+      // Like std::unordered_map::insert, an existing value is left alone.
+      template<typename V1>
+      void insert(K const &k, V1 &&v) {
+        std::uint64_t h = hash_of(k);
+        std::size_t i = probe(k, h);
+        if(ctrl_[i] == 0)
+          place(i, h, k, std::forward<V1>(v));
+      }
+
+      // Combine `v` into the existing value, or insert it if there is none.
+      template<typename V1>
+      void update(K const &k, V1 &&v) {
+        std::uint64_t h = hash_of(k);
+        std::size_t i = probe(k, h);
+        if(ctrl_[i] == 0)
+          place(i, h, k, std::forward<V1>(v));
+        else
+          vals_[i] = Combine()(std::move(vals_[i]), std::forward<V1>(v));
+      }
+
+      // Apply a batch in issue order. Returns a found flag and a value for
+      // each find in the batch.
+      std::pair<std::vector<char>, std::vector<V>>
+      apply(view<char> ops, view<K> keys, view<V> vals) {
+        std::pair<std::vector<char>, std::vector<V>> found;
+        auto k_it = keys.begin();
+        auto v_it = vals.begin();
+
+        for(char op: ops) {
+          K k = *k_it;
+          ++k_it;
+
+          switch(dmap_op(op)) {
+          case dmap_op::insert:
+            insert(k, *v_it);
+            ++v_it;
+            break;
+          case dmap_op::update:
+            update(k, *v_it);
+            ++v_it;
+            break;
+          case dmap_op::find: {
+              V const *v = find(k);
+              found.first.push_back(v != nullptr);
+              found.second.push_back(v != nullptr ? *v : V());
+            } break;
+          }
+        }
+        return found;
+      }
+
+      template<typename Fn>
+      void for_each(Fn &&fn) const {
+        for(std::size_t i=0; i < ctrl_.size(); i++) {
+          if(ctrl_[i] != 0)
+            fn(keys_[i], vals_[i]);
+        }
+      }
+    };
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // dist_unordered_map: A hash map whose keys are spread over the ranks of a
+  // team by hash. Operations on remote keys are buffered per destination and
+  // shipped as one RPC once `batch_max` of them accumulate, or on flush().
+  // Operations on keys this rank owns are applied immediately.
+  //
+  // Operations within one batch are applied in issue order, but as with
+  // individual RPCs there is no ordering between batches: wait on an insert's
+  // future before issuing a find that must see it. insert() and update()
+  // return their batch's future, shared by every insert and update in it.
+  // Construction is collective over the team, and the team must quiesce
+  // (e.g. flush() then barrier) before destruction.
+
+  template<typename K, typename V,
+           typename Hash = std::hash<K>,
+           typename KeyEqual = std::equal_to<K>,
+           typename Combine = std::plus<V>>
+  class dist_unordered_map {
+  public:
+    using key_type = K;
+    using mapped_type = V;
+    using table_type = detail::dmap_table<K, V, Hash, KeyEqual, Combine>;
+
+  private:
+    // Operations buffered for one destination.
+    struct pending {
+      std::vector<char> ops;
+      std::vector<K> keys;
+      std::vector<V> vals; // one per insert or update
+      std::vector<promise<bool, V>> finds;
+      promise<> done; // the future handed out by insert() and update()
+    };
+
+    dist_object<table_type> tables_;
+    std::size_t batch_max_;
+    std::vector<pending> pend_; // by team rank
+    promise<> outstanding_; // one anonymous dependency per batch in flight
+
+    void send(intrank_t r) {
+      pending *p = new pending(std::move(pend_[r]));
+      pend_[r] = pending();
+
+      outstanding_.require_anonymous(1);
+      promise<> all = outstanding_;
+
+      upcxx::rpc(tables_.team(), r,
+        [](dist_object<table_type> &tab, view<char> ops, view<K> keys, view<V> vals) {
+          return tab->apply(ops, keys, vals);
+        },
+        tables_, make_view(p->ops), make_view(p->keys), make_view(p->vals)
+      ).then(
+        [=](std::pair<std::vector<char>, std::vector<V>> const &found) {
+          UPCXX_ASSERT(found.first.size() == p->finds.size());
+          for(std::size_t i=0; i < p->finds.size(); i++) {
+            p->finds[i].fulfill_result(found.first[i] != 0, found.second[i]);
+            p->finds[i].finalize();
+          }
+          p->done.finalize();
+          all.fulfill_anonymous(1);
+          delete p;
+        }
+      );
+    }
+
+    void send_if_full(intrank_t r) {
+      if(pend_[r].ops.size() >= batch_max_)
+        send(r);
+    }
+
+    template<typename V1>
+    future<> mutate(detail::dmap_op op, K const &key, V1 &&val) {
+      intrank_t r = owner(key);
+
+      if(r == tables_.team().rank_me()) {
+        if(op == detail::dmap_op::insert)
+          tables_->insert(key, std::forward<V1>(val));
+        else
+          tables_->update(key, std::forward<V1>(val));
+        return make_future();
+      }
+
+      UPCXX_ASSERT_MASTER();
+      pending &p = pend_[r];
+      p.ops.push_back(char(op));
+      p.keys.push_back(key);
+      p.vals.push_back(std::forward<V1>(val));
+      future<> ans = p.done.get_future();
+      send_if_full(r);
+      return ans;
+    }
+
+  public:
+    // Collective over `tm`.
+    explicit dist_unordered_map(std::size_t batch_max = 1024,
+                                const upcxx::team &tm = upcxx::world()):
+      tables_(tm),
+      batch_max_(batch_max),
+      pend_(tm.rank_n()) {
+      UPCXX_ASSERT_ALWAYS(batch_max >= 1, "dist_unordered_map: batch_max must be at least 1");
+    }
+
+    dist_unordered_map(dist_unordered_map const&) = delete;
+    dist_unordered_map(dist_unordered_map&&) = default;
+
+    ~dist_unordered_map() {
+      if(backend::init_count > 0) {
+        UPCXX_ASSERT(
+          std::all_of(pend_.begin(), pend_.end(), [](pending const &p) { return p.ops.empty(); }),
+          "dist_unordered_map destroyed with unflushed operations");
+      }
+    }
+
+    upcxx::team& team() { return tables_.team(); }
+    const upcxx::team& team() const { return tables_.team(); }
+
+    // Team rank owning `key`.
+    intrank_t owner(K const &key) const {
+      std::uint64_t h = table_type::hash_of(key);
+      return intrank_t(((h >> 32) * std::uint64_t(tables_.team().rank_n())) >> 32);
+    }
+
+    future<> insert(K const &key, V const &val) {
+      return mutate(detail::dmap_op::insert, key, val);
+    }
+    future<> insert(K const &key, V &&val) {
+      return mutate(detail::dmap_op::insert, key, std::move(val));
+    }
+
+    // Combine `val` into the value at `key` with `Combine`, or insert it.
+    future<> update(K const &key, V const &val) {
+      return mutate(detail::dmap_op::update, key, val);
+    }
+    future<> update(K const &key, V &&val) {
+      return mutate(detail::dmap_op::update, key, std::move(val));
+    }
+
+    // Whether `key` was found, and its value (default constructed if not).
+    future<bool, V> find(K const &key) {
+      intrank_t r = owner(key);
+
+      if(r == tables_.team().rank_me()) {
+        V const *v = tables_->find(key);
+        return make_future<bool, V>(v != nullptr, v != nullptr ? *v : V());
+      }
+
+      UPCXX_ASSERT_MASTER();
+      pending &p = pend_[r];
+      p.ops.push_back(char(detail::dmap_op::find));
+      p.keys.push_back(key);
+      p.finds.push_back(promise<bool, V>());
+      future<bool, V> ans = p.finds.back().get_future();
+      send_if_full(r);
+      return ans;
+    }
+
+    // Send every buffered operation. The returned future is ready once every
+    // operation issued before this call has been applied and every find's
+    // future is ready.
+    future<> flush() {
+      for(intrank_t r=0; r < intrank_t(pend_.size()); r++) {
+        if(!pend_[r].ops.empty())
+          send(r);
+      }
+      future<> ans = outstanding_.finalize();
+      outstanding_ = promise<>();
+      return ans;
+    }
+
+    // Number of entries owned by this rank.
+    std::size_t local_size() const { return tables_->size(); }
+
+    // Call `fn(key, val)` for each entry owned by this rank.
+    template<typename Fn>
+    void for_each_local(Fn &&fn) const {
+      tables_->for_each(std::forward<Fn>(fn));
+    }
+  };
+}
+#endif
@@ -73,6 +73,10 @@ void future_header_dependent::entered_active() {
   }
 }
 
+bool future_header_dependent::active_queue_idle() {
+  return active_tail_ == nullptr;
+}
+
 void future_header::entered_ready_with_sucs(future_header *result, dependency_link *sucs_head) {
   /* Outlined:
   // caller gave us a reference in result->ref_n_
@@ -5,32 +5,12 @@
 
 #include <upcxx/diagnostic.hpp>
 #include <upcxx/lpc.hpp>
+#include <upcxx/object_pool.hpp>
 #include <upcxx/utility.hpp>
 
 #include <cstddef>
 #include <new>
 
-/* Place this macro in a class definition to give it overrides of operator
- * new/delete that just call the language provided defaults. This might seem
- * pointless now, but if we ever customize our own allocator we'll need
- * something like this slapped on all of our classes (except it won't just
- * call the std defaults). The reason we're doing this here (and now) is because
- * there is code in "./core.cpp" that wants to delete `void*` storage which it
- * *knows* must have been allocated for a `future_body`. Without these stubs,
- * calling `future_body::operator delete(x)` would be invalid. Adding these
- * stubs seems better than dumbing down offending code to always call the generic
- * deallocate, which if we get custom allocation might be slower or just wrong.
- */
-#ifndef UPCXX_OPNEW_AS_STD // pretty sure not defined anywhere, just thinking ahead.
-  #define UPCXX_OPNEW_AS_STD \
-    static void* operator new(std::size_t size) {\
-      return ::operator new(size);\
-    }\
-    static void operator delete(void *p) {\
-      ::operator delete(p);\
-    }
-#endif
-
 #if __PGI // TODO: range of impacted versions and/or C++ standard?
   // Work around a bug leading to nullptr initialization for a function pointer
   // See PR#119 for more details
@@ -43,7 +23,7 @@ namespace upcxx {
     // future headers...
   
     struct future_header {
-      UPCXX_OPNEW_AS_STD
+      UPCXX_OPNEW_POOLED(future_header)
       
       // Our refcount. A negative value indicates a static lifetime.
       int ref_n_;
@@ -181,6 +161,10 @@ namespace upcxx {
       // The "status_" must be "status_active" or "status_proxying_active".
       void entered_active();
       
+      // Whether this thread is outside of any `entered_active()` call, so a
+      // header becoming active now would leave it immediately.
+      static bool active_queue_idle();
+      
       // Put this future into the "status_proxying" state using a constructed
       // future_body_proxy<T...> instance and the future to be proxied's header.
       void enter_proxying(future_body_proxy_ *body, future_header *proxied);
@@ -295,7 +279,7 @@ namespace upcxx {
     
     // Base type for all future bodies.
     struct future_body {
-      UPCXX_OPNEW_AS_STD
+      UPCXX_OPNEW_POOLED(future_body)
       
       // The memory block holding this body. Managed by future_body::operator new/delete().
       void *storage_;
@@ -344,7 +328,7 @@ namespace upcxx {
     
     template<typename ...T>
     struct future_header_result {
-      UPCXX_OPNEW_AS_STD
+      UPCXX_OPNEW_POOLED(future_header_result)
       
       future_header base_header;
       
@@ -451,7 +435,7 @@ namespace upcxx {
     
     template<>
     struct future_header_result<> {
-      UPCXX_OPNEW_AS_STD
+      UPCXX_OPNEW_POOLED(future_header_result)
       
       static future_header the_always;
       
@@ -575,7 +559,7 @@ namespace upcxx {
     // The future header of a promise.
     template<typename ...T>
     struct future_header_promise {
-      UPCXX_OPNEW_AS_STD
+      UPCXX_OPNEW_POOLED(future_header_promise)
       
       // We "inherit" from future_header_result<T...> use "first member of standard
       // layout" since real inheritance would break standard layout.
@@ -19,6 +19,13 @@ namespace upcxx {
   };
   
   namespace detail {
+    // Can a result of type T be handed out repeatedly? References always
+    // can, values only if they copy.
+    template<typename T>
+    struct future_result_is_copyable: std::integral_constant<bool,
+        std::is_reference<T>::value || std::is_copy_constructible<T>::value
+      > {};
+    
     ////////////////////////////////////////////////////////////////////
     // future_impl_shref: Future implementation using ref-counted
     // pointer to header.
@@ -122,12 +129,19 @@ namespace upcxx {
         );
       }
 
+      // Results which can't be copied (e.g. `team`) are moved out of an
+      // rvalue future, which must then be the only reference to them.
+      static constexpr bool moves_results =
+        unique || !trait_forall<future_result_is_copyable, T...>::value;
+      
       detail::tuple_refs_return_t<
-        typename std::conditional<unique, std::tuple<T...>&&, std::tuple<T...> const&>::type
+        typename std::conditional<moves_results, std::tuple<T...>&&, std::tuple<T...> const&>::type
       >
       result_refs_or_vals() && {
+        UPCXX_ASSERT(unique || !moves_results || hdr_->ref_n_ == 1,
+          "Moving a non-copyable result out of a future requires that no other future refer to it.");
         return detail::tuple_refs(
-          static_cast<typename std::conditional<unique, std::tuple<T...>&&, std::tuple<T...> const&>::type>(
+          static_cast<typename std::conditional<moves_results, std::tuple<T...>&&, std::tuple<T...> const&>::type>(
             future_header_result<T...>::results_of(hdr_->result_)
           )
         );
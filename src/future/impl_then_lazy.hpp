@@ -90,6 +90,14 @@ namespace upcxx {
       FuArg arg_;
       Fn fn_;
       bool must_materialize_; // are we responsible for materializing the runtime header at destruction?
+
+      // Can `fn_` be fed straight from `arg_` when it's ready? Only if that
+      // yields the same references a future_dependency would, which isn't the
+      // case for non-copyable results of shared futures.
+      static constexpr bool inline_ready_arg = std::is_same<
+          decltype(std::declval<FuArg&&>().impl_.result_refs_or_vals()),
+          decltype(std::declval<future_dependency<FuArg>&&>().result_refs_or_vals())
+        >::value;
     
     public:
       template<typename FuArg1, typename Fn1>
@@ -125,8 +133,19 @@ namespace upcxx {
 
       ~future_impl_then_lazy() {
         if(must_materialize_) {
-          auto *hdr = static_cast<future_impl_then_lazy&&>(*this).steal_header();
-          header_ops::template dropref<T...>(hdr, /*maybe_nil=*/std::false_type());
+          if(inline_ready_arg && arg_.impl_.ready() && future_header_dependent::active_queue_idle()) {
+            // A materialized header would go active and run `fn_` right away
+            // only to be dropped, so skip the header and run `fn_` here. This
+            // is what keeps rpc's bound to already constructed dist_object's
+            // off the heap.
+            apply_futured_as_future<Fn&&, FuArg&&>()(
+              static_cast<Fn&&>(fn_), static_cast<FuArg&&>(arg_)
+            );
+          }
+          else {
+            auto *hdr = static_cast<future_impl_then_lazy&&>(*this).steal_header();
+            header_ops::template dropref<T...>(hdr, /*maybe_nil=*/std::false_type());
+          }
         }
       }
 
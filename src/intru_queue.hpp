@@ -4,6 +4,7 @@
 #include <upcxx/upcxx_config.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 
@@ -182,11 +183,27 @@ namespace upcxx {
     // intru_queue<..., safety=mpsc> specialization:
     
     #if UPCXX_MPSC_QUEUE_ATOMIC
+      // Enqueuers contend only on `tailp_xor_head_`, so it gets a cache line
+      // to itself away from the consumer's fields. Padding is used instead of
+      // `alignas` so the separation holds wherever the queue is allocated.
+      constexpr std::size_t intru_queue_line = 64;
+
       template<typename T, intru_queue_intruder<T> T::*next>
       class intru_queue<T, intru_queue_safety::mpsc, next> {
+        // Consumer side:
         std::atomic<T*> head_;
+        // Elements already detached from the shared list by `burst` but not
+        // yet executed, running up to the one whose `next` is `stash_end_`.
+        T *stash_;
+        std::atomic<T*> *stash_end_;
+        
+        char pad0_[intru_queue_line - sizeof(void*)];
+        
+        // Producer side:
         std::atomic<std::uintptr_t> tailp_xor_head_;
         
+        char pad1_[intru_queue_line - sizeof(void*)];
+        
       private:
         constexpr std::atomic<T*>* decode_tailp(std::uintptr_t u) const {
           return reinterpret_cast<std::atomic<T*>*>(u ^ UINTPTR_OF(&head_));
@@ -198,18 +215,25 @@ namespace upcxx {
       public:
         constexpr intru_queue():
           head_(),
-          tailp_xor_head_() {
+          stash_(),
+          stash_end_(),
+          pad0_(),
+          tailp_xor_head_(),
+          pad1_() {
         }
         
         intru_queue(intru_queue const&) = delete;
         intru_queue(intru_queue &&that) = delete;
         
         constexpr bool empty() const {
-          return this->head_.load(std::memory_order_relaxed) == nullptr;
+          return this->stash_ == nullptr &&
+                 this->head_.load(std::memory_order_relaxed) == nullptr;
         }
         
         T* peek() const {
-          return this->head_.load(std::memory_order_relaxed);
+          return this->stash_ != nullptr
+            ? this->stash_
+            : this->head_.load(std::memory_order_relaxed);
         }
 
         void enqueue(T *x);
@@ -223,6 +247,19 @@ namespace upcxx {
       private:
         template<typename Fn>
         int burst_something(int max_n, Fn &&fn, T *head);
+        template<typename Fn>
+        int burst_stash(int max_n, Fn &&fn);
+        
+        static T* spin_next(T *p) {
+          // The successor is on its way since `p` was not the tail when the
+          // list was detached, so this spin is brief.
+          T *p_next;
+          do {
+            // TODO: pause instruction here
+            p_next = (p->*next).p.load(std::memory_order_relaxed);
+          } while(p_next == nullptr);
+          return p_next;
+        }
       };
       
       ////////////////////////////////////////////////////////////////////////////
@@ -248,16 +285,34 @@ namespace upcxx {
       template<typename T, intru_queue_intruder<T> T::*next>
       template<typename Fn>
       inline int intru_queue<T, intru_queue_safety::mpsc, next>::burst(int max_n, Fn &&fn) {
+        int exec_n = 0;
+        
+        // Leftovers from the last detach are older than anything in the
+        // shared list, so they go first.
+        if(this->stash_ != nullptr) {
+          exec_n = this->burst_stash(max_n, fn);
+          if(exec_n == max_n)
+            return exec_n;
+          if(max_n > 0)
+            max_n -= exec_n;
+        }
+        
         T *head = this->head_.load(std::memory_order_relaxed);
         
         if(head == nullptr)
-          return 0;
+          return exec_n;
         
-        return this->burst_something(max_n, static_cast<Fn&&>(fn), head);
+        return exec_n + this->burst_something(max_n, static_cast<Fn&&>(fn), head);
       }
       
       template<typename T, intru_queue_intruder<T> T::*next>
       T* intru_queue<T, intru_queue_safety::mpsc, next>::dequeue() {
+        if(this->stash_ != nullptr) {
+          T *ans = this->stash_;
+          this->stash_ = &(ans->*next).p == this->stash_end_ ? nullptr : spin_next(ans);
+          return ans;
+        }
+        
         T *head = this->head_.load(std::memory_order_relaxed);
         T *head_next = (head->*next).p.load(std::memory_order_relaxed);
 
@@ -314,8 +369,9 @@ namespace upcxx {
         // So it *looks* like there is exactly one element in the list (though
         // more may be on the way as we speak). Since it isn't safe to execute
         // an element without knowing its successor first (thanks to
-        // execute_and_*DELETE*), we reset the list to start at our `head_`
-        // pointer. The reset is done with an `exchange`, with the effects:
+        // execute_and_*DELETE*), we detach the whole list and reset it to
+        // start at our `head_` pointer. The reset is done with an `exchange`,
+        // with the effects:
         //  1) The last element present in the list before reset is returned
         //     to us (actually the address of its `next` field is).
         //  2) All elements added after reset will start at `head_` and so
@@ -328,35 +384,33 @@ namespace upcxx {
                                        )
                                      );
         
-        // Process all elements before the last.
-        while(&(p->*next).p != last_next) {
-          // Get next pointer, and must spin for it. Spin should be of
-          // extremely short duration since we know that it's on the way by
-          // virtue of this not being the tail element.
-          T *p_next = (p->*next).p.load(std::memory_order_relaxed);
-          while(p_next == nullptr) {
-            // TODO: add pause instruction here
-            // asm volatile("pause\n": : :"memory");
-            p_next = (p->*next).p.load(std::memory_order_relaxed);
-          }
+        // The detached list is ours alone. Execute it within the budget and
+        // keep the rest for the next burst.
+        this->stash_ = p;
+        this->stash_end_ = last_next;
+        
+        return this->burst_stash(max_n, static_cast<Fn&&>(fn));
+      }
+      
+      template<typename T, intru_queue_intruder<T> T::*next>
+      template<typename Fn>
+      int intru_queue<T, intru_queue_safety::mpsc, next>::burst_stash(int max_n, Fn &&fn) {
+        int exec_n = 0;
+        T *p = this->stash_;
+        
+        while(true) {
+          bool last = &(p->*next).p == this->stash_end_;
+          T *p_next = last ? nullptr : spin_next(p);
           
+          // Unlink before executing, `fn` deletes `p`.
+          this->stash_ = p_next;
           fn(p);
-          p = p_next;
-
-          // We have no choice but to ignore the `max_n` budget since we
-          // are the only ones who know these elements exist (unless we kept
-          // a pointer in our datastructure to stash these elements for
-          // consumption in a later burst). Also, it is unlikely that we
-          // would blow our budget by much since this list remnant is
-          // probably length 1.
           exec_n += 1;
+          
+          if(last || max_n == exec_n)
+            return exec_n;
+          p = p_next;
         }
-
-        // And now the last.
-        fn(p);
-        exec_n += 1;
-
-        return exec_n;
       }
     
     #elif UPCXX_MPSC_QUEUE_BIGLOCK
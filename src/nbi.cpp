@@ -0,0 +1,68 @@
+#include <upcxx/nbi.hpp>
+#include <upcxx/backend/gasnet/runtime_internal.hpp>
+
+namespace gasnet = upcxx::backend::gasnet;
+namespace detail = upcxx::detail;
+
+namespace {
+  // GASNet access regions are per-thread, so is ours.
+  __thread bool nbi_region_open = false;
+}
+
+void upcxx::nbi_begin() {
+  UPCXX_ASSERT_INIT();
+  UPCXX_ASSERT_MASTER_IFSEQ();
+  UPCXX_ASSERT_ALWAYS(!nbi_region_open, "upcxx::nbi_begin(): NBI regions do not nest.");
+
+  nbi_region_open = true;
+  gex_NBI_BeginAccessRegion(/*flags*/0);
+}
+
+bool upcxx::nbi_in_region() {
+  return nbi_region_open;
+}
+
+void detail::nbi_put(
+    upcxx::intrank_t rank_d, void *buf_d,
+    const void *buf_s, std::size_t size,
+    bool src_now
+  ) {
+  UPCXX_ASSERT_MASTER_IFSEQ();
+  UPCXX_ASSERT(nbi_region_open, "upcxx::rput_nbi() called outside an NBI region.");
+
+  (void)gex_RMA_PutNBI(
+    gasnet::handle_of(upcxx::world()), rank_d,
+    buf_d, const_cast<void*>(buf_s), size,
+    src_now ? GEX_EVENT_NOW : GEX_EVENT_DEFER,
+    /*flags*/0
+  );
+}
+
+void detail::nbi_get(
+    void *buf_d,
+    upcxx::intrank_t rank_s, const void *buf_s,
+    std::size_t size
+  ) {
+  UPCXX_ASSERT_MASTER_IFSEQ();
+  UPCXX_ASSERT(nbi_region_open, "upcxx::rget_nbi() called outside an NBI region.");
+
+  (void)gex_RMA_GetNBI(
+    gasnet::handle_of(upcxx::world()),
+    buf_d, rank_s, const_cast<void*>(buf_s), size,
+    /*flags*/0
+  );
+}
+
+void detail::nbi_end_inject(gasnet::handle_cb *cb) {
+  UPCXX_ASSERT_MASTER_IFSEQ();
+  UPCXX_ASSERT_ALWAYS(nbi_region_open, "upcxx::nbi_end() called without a matching nbi_begin().");
+
+  nbi_region_open = false;
+  gex_Event_t h = gex_NBI_EndAccessRegion(/*flags*/0);
+
+  // An empty or already retired region comes back as GEX_EVENT_INVALID,
+  // which the handle queue treats as complete on its next burst.
+  cb->handle = reinterpret_cast<uintptr_t>(h);
+  gasnet::register_cb(cb, gasnet::handle_cb_class::rma_put);
+  gasnet::after_gasnet();
+}
@@ -0,0 +1,138 @@
+#ifndef _3b0f6a52_8e41_4c9d_a7c2_5d19e04b8f3e
+#define _3b0f6a52_8e41_4c9d_a7c2_5d19e04b8f3e
+
+#include <upcxx/backend.hpp>
+#include <upcxx/completion.hpp>
+#include <upcxx/global_ptr.hpp>
+#include <upcxx/serialization.hpp>
+
+#include <upcxx/backend/gasnet/runtime.hpp>
+
+// NBI regions: puts and gets issued between nbi_begin() and nbi_end() carry no
+// completion object of their own. They are handed to GASNet as implicit-handle
+// operations inside an access region, and the region as a whole completes
+// through the single notification requested of nbi_end(). Regions belong to
+// the calling thread and do not nest.
+
+namespace upcxx {
+  namespace detail {
+    ////////////////////////////////////////////////////////////////////
+    // nbi_event_values: Value for completions_state's EventValues
+    // template argument. nbi region events always report no values.
+    struct nbi_event_values {
+      template<typename Event>
+      using tuple_t = std::tuple<>;
+    };
+
+    void nbi_put(intrank_t rank_d, void *buf_d, const void *buf_s, std::size_t size, bool src_now);
+    void nbi_get(void *buf_d, intrank_t rank_s, const void *buf_s, std::size_t size);
+    void nbi_end_inject(backend::gasnet::handle_cb *cb);
+  }
+
+  // Opens an NBI region on the calling thread.
+  void nbi_begin();
+
+  // Whether the calling thread has an NBI region open.
+  bool nbi_in_region();
+
+  // Put a value. It is captured before returning.
+  template<typename T>
+  void rput_nbi(T value_s, global_ptr<T> gp_d) {
+    static_assert(
+      is_trivially_serializable<T>::value,
+      "RMA operations only work on TriviallySerializable types."
+    );
+    UPCXX_STATIC_ASSERT_VALUE_SIZE(T, rput_nbi);
+
+    UPCXX_ASSERT_INIT();
+    UPCXX_GPTR_CHK(gp_d);
+    UPCXX_ASSERT(gp_d, "pointer arguments to rput_nbi may not be null");
+
+    detail::nbi_put(gp_d.rank_, gp_d.raw_ptr_, &value_s, sizeof(T), /*src_now=*/true);
+  }
+
+  // Put an array. The source buffer must not be modified until the region
+  // completes.
+  template<typename T>
+  void rput_nbi(T const *buf_s, global_ptr<T> gp_d, std::size_t n) {
+    static_assert(
+      is_trivially_serializable<T>::value,
+      "RMA operations only work on TriviallySerializable types."
+    );
+
+    UPCXX_ASSERT_INIT();
+    UPCXX_GPTR_CHK(gp_d);
+    UPCXX_ASSERT(buf_s && gp_d, "pointer arguments to rput_nbi may not be null");
+
+    detail::nbi_put(gp_d.rank_, gp_d.raw_ptr_, buf_s, n*sizeof(T), /*src_now=*/false);
+  }
+
+  // Get an array. The destination buffer is undefined until the region
+  // completes.
+  template<typename T>
+  void rget_nbi(global_ptr<const T> gp_s, T *buf_d, std::size_t n) {
+    static_assert(
+      is_trivially_serializable<T>::value,
+      "RMA operations only work on TriviallySerializable types."
+    );
+
+    UPCXX_ASSERT_INIT();
+    UPCXX_GPTR_CHK(gp_s);
+    UPCXX_ASSERT(gp_s && buf_d, "pointer arguments to rget_nbi may not be null");
+
+    detail::nbi_get(buf_d, gp_s.rank_, gp_s.raw_ptr_, n*sizeof(T));
+  }
+
+  // Closes the calling thread's NBI region. Operation completion fires once
+  // every put and get issued inside it has completed.
+  template<typename Cxs = completions<future_cx<operation_cx_event>>>
+  UPCXX_NODISCARD
+  typename detail::completions_returner<
+      /*EventPredicate=*/detail::event_is_here,
+      /*EventValues=*/detail::nbi_event_values,
+      typename std::decay<Cxs>::type
+    >::return_t
+  nbi_end(Cxs &&cxs = completions<future_cx<operation_cx_event>>({})) {
+    using CxsDecayed = typename std::decay<Cxs>::type;
+
+    UPCXX_ASSERT_INIT();
+    UPCXX_ASSERT_ALWAYS(
+      (detail::completions_has_event<CxsDecayed, operation_cx_event>::value),
+      "Not requesting operation completion is surely an error."
+    );
+    UPCXX_ASSERT_ALWAYS(
+      (!detail::completions_has_event<CxsDecayed, source_cx_event>::value &&
+       !detail::completions_has_event<CxsDecayed, remote_cx_event>::value),
+      "nbi_end does not support source or remote completion."
+    );
+
+    struct nbi_cb final: backend::gasnet::handle_cb {
+      UPCXX_OPNEW_POOLED(nbi_cb)
+
+      detail::completions_state<
+        /*EventPredicate=*/detail::event_is_here,
+        /*EventValues=*/detail::nbi_event_values,
+        CxsDecayed> state;
+
+      nbi_cb(Cxs &&cxs): state(std::forward<Cxs>(cxs)) {}
+
+      void execute_and_delete(backend::gasnet::handle_cb_successor) {
+        state.template operator()<operation_cx_event>();
+        delete this;
+      }
+    };
+
+    nbi_cb *cb = new nbi_cb(std::forward<Cxs>(cxs));
+
+    auto returner = detail::completions_returner<
+        /*EventPredicate=*/detail::event_is_here,
+        /*EventValues=*/detail::nbi_event_values,
+        CxsDecayed
+      >(cb->state);
+
+    detail::nbi_end_inject(cb);
+
+    return returner();
+  }
+}
+#endif
@@ -0,0 +1,75 @@
+#include <upcxx/notify_counter.hpp>
+#include <upcxx/backend/gasnet/runtime_internal.hpp>
+
+#if UPCXX_BACKEND_GASNET
+  #include <gasnet_ratomic.h>
+#endif
+
+namespace gasnet = upcxx::backend::gasnet;
+namespace detail = upcxx::detail;
+
+using upcxx::notify_counter;
+
+using std::uint64_t;
+using std::uintptr_t;
+
+notify_counter::notify_counter(const team &tm):
+  ad_({atomic_op::add, atomic_op::load, atomic_op::store}, tm),
+  mine_(upcxx::new_<uint64_t>(0)) {
+  UPCXX_ASSERT_INIT();
+}
+
+void notify_counter::destroy(entry_barrier eb) {
+  ad_.destroy(eb);
+  upcxx::delete_(mine_);
+  mine_ = nullptr;
+}
+
+uint64_t notify_counter::load() const {
+  UPCXX_ASSERT_MASTER_IFSEQ();
+  UPCXX_ASSERT(mine_, "notify_counter is not constructed");
+
+  uint64_t ans;
+  gex_Event_t h = gex_AD_OpNB_U64(
+    reinterpret_cast<gex_AD_t>(ad_.ad_gex_handle), &ans,
+    mine_.rank_, mine_.raw_ptr_, GEX_OP_GET, 0, 0,
+    GEX_FLAG_AD_ACQ | GEX_FLAG_RANK_IS_JOBRANK
+  );
+  gex_Event_Wait(h); // local, so this never waits on the network
+  return ans;
+}
+
+void notify_counter::wait_until(uint64_t n) const {
+  while(this->load() < n)
+    upcxx::progress();
+}
+
+void notify_counter::reset() {
+  UPCXX_ASSERT_MASTER_IFSEQ();
+  UPCXX_ASSERT(mine_, "notify_counter is not constructed");
+
+  gex_Event_t h = gex_AD_OpNB_U64(
+    reinterpret_cast<gex_AD_t>(ad_.ad_gex_handle), nullptr,
+    mine_.rank_, mine_.raw_ptr_, GEX_OP_SET, 0, 0,
+    GEX_FLAG_RANK_IS_JOBRANK
+  );
+  gex_Event_Wait(h);
+}
+
+void detail::counter_cx_fire(uintptr_t ad, intrank_t rank, uint64_t *addr, uint64_t delta) {
+  UPCXX_ASSERT_MASTER_IFSEQ();
+
+  gex_Event_t h = gex_AD_OpNB_U64(
+    reinterpret_cast<gex_AD_t>(ad), nullptr,
+    rank, addr, GEX_OP_ADD, delta, 0,
+    GEX_FLAG_AD_REL | GEX_FLAG_RANK_IS_JOBRANK
+  );
+
+  // Nobody waits on the increment, its handle just needs to be retired.
+  if(h != GEX_EVENT_INVALID) {
+    gasnet::handle_cb *cb = gasnet::make_handle_cb([]() {});
+    cb->handle = reinterpret_cast<uintptr_t>(h);
+    gasnet::register_cb(cb, gasnet::handle_cb_class::amo);
+    gasnet::after_gasnet();
+  }
+}
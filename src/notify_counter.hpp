@@ -0,0 +1,63 @@
+#ifndef _b71c2e90_4d3f_4a6b_9e58_2f0a6d8c41e7
+#define _b71c2e90_4d3f_4a6b_9e58_2f0a6d8c41e7
+
+#include <upcxx/allocate.hpp>
+#include <upcxx/atomic.hpp>
+#include <upcxx/backend.hpp>
+#include <upcxx/completion.hpp>
+#include <upcxx/global_ptr.hpp>
+#include <upcxx/team.hpp>
+
+#include <cstdint>
+
+namespace upcxx {
+  // notify_counter: A 64-bit counter per team member, living in the shared
+  // segment, which other ranks bump as the remote completion of their
+  // operations via `remote_cx::as_counter(ctr, where, delta)`. The increment
+  // is a network atomic issued after the operation completes, so the owner
+  // learns "N operations have landed" by polling its own counter, with no
+  // UPC++ handler or lpc running on its side (conduits without offloaded
+  // atomics still service the increment in a GASNet AM handler on the
+  // owner's CPU). Construction and destroy()
+  // are collective over the team. Owners hand out `where()` like any other
+  // global_ptr, and every access to the counter goes through the counter's
+  // atomic domain, so increments from local_team() peers and from the
+  // network are coherent.
+  class notify_counter {
+    friend struct detail::support_as_counter;
+
+    detail::atomic_domain_untyped<8,0> ad_;
+    global_ptr<std::uint64_t> mine_;
+
+    counter_cx<operation_cx_event> counter_cx_for(global_ptr<std::uint64_t> where,
+                                                  std::uint64_t delta) const {
+      UPCXX_ASSERT_INIT();
+      UPCXX_ASSERT(ad_.ad_gex_handle != 0, "notify_counter is not constructed");
+      UPCXX_GPTR_CHK(where);
+      UPCXX_ASSERT(where, "remote_cx::as_counter: counter location may not be null");
+      UPCXX_ASSERT(ad_.parent_tm_->from_world(where.rank_, -1) >= 0,
+        "remote_cx::as_counter: counter must belong to a member of the counter's team");
+      return counter_cx<operation_cx_event>{ad_.ad_gex_handle, where.rank_, where.raw_ptr_, delta};
+    }
+
+  public:
+    explicit notify_counter(const team &tm = upcxx::world());
+    notify_counter(notify_counter const&) = delete;
+
+    // Collective. Pending increments to this counter must have completed.
+    void destroy(entry_barrier eb = entry_barrier::user);
+
+    // This rank's counter, for distribution to the ranks that will notify it.
+    global_ptr<std::uint64_t> where() const { return mine_; }
+
+    // Current value of this rank's counter (acquire ordering).
+    std::uint64_t load() const;
+
+    // Make user-level progress until this rank's counter reaches `n`.
+    void wait_until(std::uint64_t n) const;
+
+    // Set this rank's counter back to zero. No increments may be in flight.
+    void reset();
+  };
+}
+#endif
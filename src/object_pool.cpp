@@ -0,0 +1,65 @@
+#include <upcxx/object_pool.hpp>
+
+#include <pthread.h>
+
+namespace detail = upcxx::detail;
+
+using detail::obj_pool_align;
+using detail::obj_pool_block;
+using detail::obj_pool_class_n;
+using detail::obj_pool_tag;
+using detail::obj_pool_tls_t;
+
+__thread obj_pool_tls_t detail::obj_pool_tls; // zero-init
+
+// Reset from UPCXX_OBJECT_POOL during upcxx::init(), this covers allocations
+// made before then.
+int detail::obj_pool_depth = 64;
+
+namespace {
+  pthread_key_t obj_pool_key;
+  pthread_once_t obj_pool_key_once = PTHREAD_ONCE_INIT;
+
+  // Return an exiting thread's cached blocks to the system.
+  void obj_pool_drain(void *arg) {
+    obj_pool_tls_t *tls = static_cast<obj_pool_tls_t*>(arg);
+
+    for(int cls=0; cls < obj_pool_class_n; cls++) {
+      obj_pool_block *b = tls->head[cls];
+      while(b != nullptr) {
+        obj_pool_block *next = b->next;
+        ::operator delete(b);
+        b = next;
+      }
+      tls->head[cls] = nullptr;
+      tls->n[cls] = 0;
+    }
+
+    // Later thread-exit destructors may still free objects, they will
+    // re-register us.
+    tls->adopted = false;
+  }
+
+  void obj_pool_make_key() {
+    int ok = pthread_key_create(&obj_pool_key, obj_pool_drain);
+    UPCXX_ASSERT_ALWAYS(ok == 0);
+  }
+}
+
+void detail::obj_pool_adopt() {
+  pthread_once(&obj_pool_key_once, obj_pool_make_key);
+  pthread_setspecific(obj_pool_key, &obj_pool_tls);
+  obj_pool_tls.adopted = true;
+}
+
+void* detail::obj_pool_alloc_slow(std::size_t size, std::size_t align) {
+  // Over-aligned or large objects: the tag goes just ahead of the aligned
+  // object and remembers where the allocation really starts.
+  if(align < obj_pool_align)
+    align = obj_pool_align;
+
+  void *base = detail::alloc_aligned(align + size, align);
+  char *p = static_cast<char*>(base) + align;
+  ::new(p - obj_pool_align) obj_pool_tag{obj_pool_class_n, base};
+  return p;
+}
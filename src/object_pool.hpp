@@ -0,0 +1,113 @@
+#ifndef _9d1c4e27_52b3_4a8f_b6e0_3f7a21c85d94
+#define _9d1c4e27_52b3_4a8f_b6e0_3f7a21c85d94
+
+#include <upcxx/utility.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/* Place this macro in a class definition to have its instances allocated from
+ * the calling thread's object pool (see below). `Self` is the enclosing class
+ * and only determines the alignment requested. Since the pool records each
+ * block's size class in front of the object, blocks may be freed through
+ * `Self::operator delete(p)` without knowing the most-derived type, which
+ * code in "./future/core.cpp" relies upon for `future_body` storage.
+ */
+#define UPCXX_OPNEW_POOLED(Self) \
+  static void* operator new(std::size_t size) {\
+    return ::upcxx::detail::obj_pool_alloc(size, alignof(Self));\
+  }\
+  static void operator delete(void *p) {\
+    ::upcxx::detail::obj_pool_free(p);\
+  }
+
+namespace upcxx {
+  namespace detail {
+    ////////////////////////////////////////////////////////////////////////////
+    // Object pool: per-thread free lists of small heap blocks, binned by size
+    // class, backing the runtime's short-lived per-operation objects (rma and
+    // atomic completion callbacks, future headers and bodies). Allocation and
+    // release are a pop/push on a thread-local list, so no locking happens
+    // in either backend. A block freed on a different thread than it was
+    // allocated on simply migrates to the freeing thread's lists. Each list
+    // caches at most `obj_pool_depth` blocks, beyond which blocks go back to
+    // the system allocator. `UPCXX_OBJECT_POOL=0` disables caching.
+
+    // Every block starts with one of these, the object follows it.
+    struct obj_pool_tag {
+      int cls; // size class, obj_pool_class_n for blocks not managed by a list
+      void *base; // start of the underlying allocation for unmanaged blocks
+    };
+
+    struct obj_pool_block {
+      obj_pool_block *next;
+    };
+
+    constexpr std::size_t obj_pool_align =
+      alignof(std::max_align_t) > sizeof(obj_pool_tag)
+        ? alignof(std::max_align_t)
+        : sizeof(obj_pool_tag);
+    constexpr std::size_t obj_pool_granule = 32;
+    constexpr int obj_pool_class_n = 16; // blocks up to 512 bytes
+
+    struct obj_pool_tls_t {
+      obj_pool_block *head[obj_pool_class_n];
+      int n[obj_pool_class_n];
+      bool adopted; // registered for draining at thread exit
+    };
+
+    extern __thread obj_pool_tls_t obj_pool_tls;
+    extern int obj_pool_depth;
+
+    void* obj_pool_alloc_slow(std::size_t size, std::size_t align);
+    void obj_pool_adopt();
+
+    inline void* obj_pool_alloc(std::size_t size, std::size_t align) {
+      std::size_t cls = (size + obj_pool_align - 1)/obj_pool_granule;
+
+      if(align <= obj_pool_align && cls < std::size_t(obj_pool_class_n)) {
+        obj_pool_tls_t &tls = obj_pool_tls;
+        obj_pool_block *b = tls.head[cls];
+
+        if(b != nullptr) {
+          tls.head[cls] = b->next;
+          tls.n[cls] -= 1;
+        }
+        else
+          b = static_cast<obj_pool_block*>(::operator new((cls+1)*obj_pool_granule));
+
+        ::new(b) obj_pool_tag{int(cls), b};
+        return reinterpret_cast<char*>(b) + obj_pool_align;
+      }
+      else
+        return obj_pool_alloc_slow(size, align);
+    }
+
+    inline void obj_pool_free(void *p) {
+      if(p == nullptr) return;
+
+      obj_pool_tag *tag = reinterpret_cast<obj_pool_tag*>(static_cast<char*>(p) - obj_pool_align);
+      int cls = tag->cls;
+
+      if(cls < obj_pool_class_n) {
+        obj_pool_tls_t &tls = obj_pool_tls;
+
+        if(tls.n[cls] < obj_pool_depth) {
+          if(!tls.adopted)
+            obj_pool_adopt();
+
+          obj_pool_block *b = reinterpret_cast<obj_pool_block*>(tag);
+          b->next = tls.head[cls];
+          tls.head[cls] = b;
+          tls.n[cls] += 1;
+        }
+        else
+          ::operator delete(tag);
+      }
+      else
+        std::free(tag->base);
+    }
+  }
+}
+#endif
@@ -41,7 +41,9 @@ namespace upcxx {
   private:
     // persona *owner = this;
     std::atomic<std::uintptr_t> owner_xor_this_;
-  
+
+    // Other threads only write the tail of these, which the mpsc queue pads
+    // onto its own cache line, so enqueuers don't disturb the fields below.
     detail::lpc_inbox<detail::intru_queue_safety::mpsc> peer_inbox_[2];
     detail::lpc_inbox<detail::intru_queue_safety::none> self_inbox_[2];
     
@@ -49,6 +49,10 @@ void upcxx::detail::reduce_one_or_all_trivial_erased(
       upcxx::say()<<"gex_Coll_ReduceToXxxNB(dt="<<ty_id<<", op="<<op_id<<")";
   #endif
   
+  if(gasnet::node_coll_reduce(tm, root_or_all, src, dst, elt_sz, elt_n,
+                              ty_id, op_id, op_vecfn, op_data, cb))
+    return;
+  
   gex_Event_t e = root_or_all >= 0
     ? gex_Coll_ReduceToOneNB(
         gasnet::handle_of(tm), root_or_all,
@@ -71,7 +75,7 @@ void upcxx::detail::reduce_one_or_all_trivial_erased(
     // while we register. This is safe because we've already asserted that it must
     // be active.
     detail::persona_scope_redundant master_on_top(backend::master, detail::the_persona_tls);
-    backend::gasnet::register_cb(cb);
+    backend::gasnet::register_cb(cb, backend::gasnet::handle_cb_class::coll);
   }
   
   backend::gasnet::after_gasnet();
@@ -6,8 +6,14 @@
 #include <upcxx/rpc.hpp>
 #include <upcxx/team.hpp>
 #include <upcxx/utility.hpp>
+#include <upcxx/view.hpp>
 
+#include <algorithm>
+#include <complex>
+#include <cstdlib>
+#include <cstring>
 #include <type_traits>
+#include <vector>
 
 /* NOTE: Reductions have full completions support, unlike the other
  * collectives, but this hasn't been verified as correct with a test.
@@ -78,6 +84,22 @@ namespace upcxx {
   constexpr detail::op_wrap<detail::opfn_min_not_max<false>, /*fast_demanded=*/true> op_fast_max = {};
   
   namespace detail {
+    /* `detail::reduce_op_lanes<Op,T>` describes T as `n` independent lanes of
+     * `lane_type` when Op acts on T lane-wise, which lets GEX reduce T as an
+     * array of a type it supports natively.
+     */
+    template<typename Op, typename T>
+    struct reduce_op_lanes {
+      static constexpr std::size_t n = 1;
+      using lane_type = T;
+    };
+    // std::complex adds lane-wise (but doesn't multiply or order that way)
+    template<bool fast_demanded, typename S>
+    struct reduce_op_lanes<op_wrap<opfn_add, fast_demanded>, std::complex<S>> {
+      static constexpr std::size_t n = 2;
+      using lane_type = S;
+    };
+    
     /* `detail::reduce_op_has_fast<Op,T>` matches Op and T and reports to bools:
      * whether the combo is offloadable in theory (possibly) and in practice (actually).
      */ 
@@ -90,11 +112,13 @@ namespace upcxx {
     // match where `Op = op_wrap<OpFn,...>`
     template<typename OpFn, bool fast_demanded, typename T>
     struct reduce_op_has_fast<op_wrap<OpFn, fast_demanded>, T> {
-      static constexpr bool possibly = std::is_integral<T>::value || (
-          !OpFn::integral_only && std::is_floating_point<T>::value
+      using lane_type = typename reduce_op_lanes<op_wrap<OpFn, fast_demanded>, T>::lane_type;
+      
+      static constexpr bool possibly = std::is_integral<lane_type>::value || (
+          !OpFn::integral_only && std::is_floating_point<lane_type>::value
         );
       
-      static constexpr bool actually = possibly && (8*sizeof(T)==32 || 8*sizeof(T)==64);
+      static constexpr bool actually = possibly && (8*sizeof(lane_type)==32 || 8*sizeof(lane_type)==64);
     };
     
     ////////////////////////////////////////////////////////////////////////////
@@ -114,18 +138,33 @@ namespace upcxx {
     struct reduce_op_slow_id:
       reduce_op_slow_op_id,
       reduce_op_slow_ty_id {
+
+      static constexpr std::size_t lanes = 1;
       
       // The vectorized user provided function for GEX_OP_USER
       static void op_vecfn(const void *arg1, void *arg2_and_out, std::size_t n, const void *data) {
-        T const *a = static_cast<T const*>(arg1);
-        T *b_out = static_cast<T*>(arg2_and_out);
-        Op const *op = static_cast<Op const*>(data);
-        
-        while(n--) {
-          *b_out = (*op)(*a, *b_out);
-          a++;
-          b_out++;
-        }
+        op_vecfn_(
+          static_cast<T const*>(arg1), static_cast<T*>(arg2_and_out), n,
+          *static_cast<Op const*>(data), std::is_empty<Op>()
+        );
+      }
+
+    private:
+      // GEX never hands us overlapping operands, and saying so is what lets
+      // the compiler vectorize this loop for simple ops and element types.
+      static void op_vecfn_loop_(T const *__restrict a, T *__restrict b_out, std::size_t n, Op const &op) {
+        for(std::size_t i=0; i != n; i++)
+          b_out[i] = op(a[i], b_out[i]);
+      }
+      
+      // A stateless op is copied locally so the compiler can see it isn't
+      // modified by the stores through `b_out`.
+      static void op_vecfn_(T const *a, T *b_out, std::size_t n, Op const &op, std::true_type is_empty) {
+        Op const op_local(op);
+        op_vecfn_loop_(a, b_out, n, op_local);
+      }
+      static void op_vecfn_(T const *a, T *b_out, std::size_t n, Op const &op, std::false_type is_empty) {
+        op_vecfn_loop_(a, b_out, n, op);
       }
     };
     
@@ -176,6 +215,7 @@ namespace upcxx {
      *   static const uintptr_t op_id; // the GEX_OP_***
      *   static const void(*op_vecfn)(...); // function pointer for GEX_OP_USER
      *   static const uintptr_t ty_id; // the GEX_DT_***
+     *   static constexpr size_t lanes; // number of GEX elements per T
      */
     template<typename Op, typename T,
              bool possibly_fast = reduce_op_has_fast<Op,T>::possibly,
@@ -185,7 +225,8 @@ namespace upcxx {
     template<typename Op, typename T>
     struct reduce_op_best_id<Op, T, /*possibly=*/true, /*actually=*/true>:
       reduce_op_fast_op_id<Op>,
-      reduce_op_fast_ty_id<T> {
+      reduce_op_fast_ty_id<typename reduce_op_lanes<Op,T>::lane_type> {
+      static constexpr std::size_t lanes = reduce_op_lanes<Op,T>::n;
     };
     template<typename Op, typename T>
     struct reduce_op_best_id<Op, T, /*possibly=*/true, /*actually=*/false>:
@@ -299,7 +340,9 @@ namespace upcxx {
       
       reduce_one_or_all_trivial_erased(
           tm, root_or_all,
-          &cb->in_out, &cb->in_out, sizeof(T), 1,
+          &cb->in_out, &cb->in_out,
+          sizeof(T)/detail::reduce_op_best_id<BinaryOp,T>::lanes,
+          detail::reduce_op_best_id<BinaryOp,T>::lanes,
           detail::reduce_op_best_id<BinaryOp,T>::ty_id,
           detail::reduce_op_best_id<BinaryOp,T>::op_id,
           detail::reduce_op_best_id<BinaryOp,T>::op_vecfn,
@@ -371,7 +414,9 @@ namespace upcxx {
       
       reduce_one_or_all_trivial_erased(
           tm, root_or_all,
-          src, dst, sizeof(T), n,
+          src, dst,
+          sizeof(T)/detail::reduce_op_best_id<BinaryOp,T>::lanes,
+          n*detail::reduce_op_best_id<BinaryOp,T>::lanes,
           detail::reduce_op_best_id<BinaryOp,T>::ty_id,
           detail::reduce_op_best_id<BinaryOp,T>::op_id,
           detail::reduce_op_best_id<BinaryOp,T>::op_vecfn,
@@ -603,6 +648,360 @@ namespace upcxx {
       );
   }
   
+  //////////////////////////////////////////////////////////////////////////////
+  // upcxx::reduce_scatter and upcxx::reduce_all_inplace
+  
+  namespace detail {
+    // Elements per message when the ring streams a block around the team.
+    // Each chunk stays under the eager cutover so a hop can fold and forward
+    // the front of a block while the rest is still in flight.
+    template<typename T>
+    std::size_t reduce_ring_chunk_n() {
+      constexpr std::size_t header_slack = 256;
+      std::size_t cutover = backend::gasnet::am_size_rdzv_cutover;
+      std::size_t bytes = cutover > 4*header_slack ? cutover - header_slack : 3*header_slack;
+      return bytes/sizeof(T) != 0 ? bytes/sizeof(T) : 1;
+    }
+    
+    // Ring reduction over a vector cut into `rank_n` blocks, block `j` being
+    // owned by team rank `j`. Blocks hold `base` elements and the first `rem`
+    // of them one more. The partial result for block `j` starts at rank `j+1`
+    // and travels once around the ring, each rank folding in its own
+    // contribution, until it reaches `j` complete. This
+    // moves (rank_n-1)/rank_n of the vector through every rank, which is
+    // bandwidth optimal for any team size, and all blocks are in motion at
+    // once. When `all` is set the finished block takes a second lap so every
+    // rank ends up with the whole vector.
+    //
+    // Chunks may land before this rank has entered the collective. Those are
+    // held aside until entry supplies `src`, `dst` and `op`.
+    template<typename T, typename Op, typename Cxs>
+    struct reduce_ring_state {
+      using cxs_state_t = detail::completions_state<
+        /*EventPredicate=*/detail::event_is_here,
+        /*EventValues=*/detail::reduce_vector_event_values,
+        Cxs>;
+      
+      struct early_chunk {
+        bool fin;
+        intrank_t blk;
+        std::size_t off, m;
+        T *elts;
+      };
+      
+      bool entered = false;
+      bool all;
+      T const *src;
+      T *dst;
+      std::size_t base, rem;
+      T *scratch = nullptr; // one chunk, used when `all` is not set
+      std::size_t awaiting = 0; // chunk arrivals left before we're done
+      std::vector<early_chunk> early;
+      detail::raw_storage<Op> op_raw;
+      detail::raw_storage<cxs_state_t> cxs_st_raw;
+      
+      ~reduce_ring_state() {
+        if(entered) {
+          op_raw.destruct();
+          cxs_st_raw.destruct();
+        }
+        std::free(scratch);
+      }
+      
+      struct chunk_fn {
+        void operator()(team_id tm_id, digest id, bool fin, intrank_t blk,
+                        std::size_t off, view<T> elts) const {
+          reduce_ring_state *s = detail::template registered_state<reduce_ring_state>(id);
+          
+          if(!s->entered) {
+            T *copy = static_cast<T*>(detail::alloc_aligned(elts.size()*sizeof(T), alignof(T)));
+            std::memcpy((void*)copy, elts.begin(), elts.size()*sizeof(T));
+            s->early.push_back(early_chunk{fin, blk, off, elts.size(), copy});
+            return;
+          }
+          
+          s->fold(tm_id.here(), id, fin, blk, off, elts.begin(), elts.size());
+          
+          if(0 == --s->awaiting)
+            backend::during_user([=]() { s->finish(id); });
+        }
+      };
+      
+      std::size_t blk_off(intrank_t j) const {
+        return j*base + std::min<std::size_t>(j, rem);
+      }
+      std::size_t blk_len(intrank_t j) const {
+        return base + (std::size_t(j) < rem ? 1 : 0);
+      }
+      
+      static void send(team const &tm, digest id, bool fin, intrank_t blk,
+                       std::size_t off, T const *elts, std::size_t m) {
+        intrank_t next = tm.rank_me() + 1;
+        next -= next == tm.rank_n() ? tm.rank_n() : 0;
+        
+        backend::send_am_master<progress_level::internal>(
+          tm[next],
+          upcxx::bind(chunk_fn(), tm.id(), id, fin, blk, off, upcxx::make_view(elts, elts + m, m))
+        );
+      }
+      
+      // Apply one arriving chunk: either a partial to fold our contribution
+      // into, or (`fin`) a finished chunk on its second lap.
+      void fold(team const &tm, digest id, bool fin, intrank_t blk,
+                std::size_t off, T const *in, std::size_t m) {
+        intrank_t me = tm.rank_me();
+        intrank_t next = me + 1 == tm.rank_n() ? 0 : me + 1;
+        T *out = all ? dst + blk_off(blk) + off : blk == me ? dst + off : scratch;
+        
+        if(fin)
+          std::memcpy((void*)out, in, m*sizeof(T));
+        else {
+          Op const &op = op_raw.value();
+          T const *mine = src + blk_off(blk) + off;
+          // `out` may alias `mine` when in place, each element is read before
+          // it is overwritten
+          for(std::size_t i=0; i < m; i++)
+            ::new(out + i) T(op(T(in[i]), mine[i]));
+        }
+        
+        if(fin ? next != blk : (blk != me || all))
+          send(tm, id, fin || blk == me, blk, off, out, m);
+      }
+      
+      void finish(digest id) {
+        cxs_st_raw.value().template operator()<operation_cx_event>();
+        detail::registry.erase(id);
+        delete this;
+      }
+    };
+    
+    template<typename T, typename BinaryOp, typename Cxs>
+    typename detail::completions_returner<
+        /*EventPredicate=*/detail::event_is_here,
+        /*EventValues=*/detail::reduce_vector_event_values,
+        typename std::decay<Cxs>::type
+      >::return_t
+    reduce_ring(
+        T const *src, T *dst, std::size_t n, bool all,
+        BinaryOp op, const team &tm, Cxs &&cxs
+      ) {
+      // `n` is the length of the whole vector
+      using CxsDecayed = typename std::decay<Cxs>::type;
+      using state_t = reduce_ring_state<T, BinaryOp, CxsDecayed>;
+      
+      digest id = const_cast<team*>(&tm)->next_collective_id(detail::internal_only());
+      state_t *s = detail::template registered_state<state_t>(id);
+      
+      intrank_t me = tm.rank_me();
+      intrank_t rank_n = tm.rank_n();
+      std::size_t chunk_n = reduce_ring_chunk_n<T>();
+      
+      s->entered = true;
+      s->all = all;
+      s->src = src;
+      s->dst = dst;
+      s->base = n/rank_n;
+      s->rem = n%rank_n;
+      if(!all)
+        s->scratch = static_cast<T*>(detail::alloc_aligned(chunk_n*sizeof(T), alignof(T)));
+      
+      // we receive every block's partial except our predecessor's (we start
+      // that one), and on the second lap every finished block but our own
+      intrank_t first = me == 0 ? rank_n-1 : me-1;
+      for(intrank_t j=0; j < rank_n; j++) {
+        std::size_t chunks = (s->blk_len(j) + chunk_n-1)/chunk_n;
+        s->awaiting += (j != first ? chunks : 0) + (all && j != me ? chunks : 0);
+      }
+      ::new(&s->op_raw) BinaryOp(std::move(op));
+      ::new(&s->cxs_st_raw) typename state_t::cxs_state_t(std::forward<Cxs>(cxs));
+      
+      auto returner = detail::completions_returner<
+          /*EventPredicate=*/detail::event_is_here,
+          /*EventValues=*/detail::reduce_vector_event_values,
+          CxsDecayed
+        >(s->cxs_st_raw.value());
+      
+      std::size_t first_len = s->blk_len(first);
+      for(std::size_t off=0; off < first_len; off += chunk_n)
+        state_t::send(tm, id, false, first, off, src + s->blk_off(first) + off, std::min(chunk_n, first_len - off));
+      
+      for(typename state_t::early_chunk const &c: s->early) {
+        s->fold(tm, id, c.fin, c.blk, c.off, c.elts, c.m);
+        std::free(c.elts);
+        s->awaiting -= 1;
+      }
+      s->early.clear();
+      
+      if(s->awaiting == 0)
+        s->finish(id);
+      
+      return returner();
+    }
+    
+    template<typename T, typename BinaryOp, typename Cxs>
+    typename detail::completions_returner<
+        /*EventPredicate=*/detail::event_is_here,
+        /*EventValues=*/detail::reduce_vector_event_values,
+        typename std::decay<Cxs>::type
+      >::return_t
+    reduce_scatter_gex(
+        T const *src, T *dst, std::size_t n,
+        BinaryOp op, const team &tm, Cxs &&cxs
+      ) {
+      using CxsDecayed = typename std::decay<Cxs>::type;
+      using cxs_state_here_t = detail::completions_state<
+        /*EventPredicate=*/detail::event_is_here,
+        /*EventValues=*/detail::reduce_vector_event_values,
+        CxsDecayed>;
+      
+      // Reduce the whole vector everywhere into a temporary and keep our
+      // slice. Only used below the ring cutover so the temporary is small.
+      struct my_cb final: backend::gasnet::handle_cb {
+        BinaryOp op;
+        cxs_state_here_t cxs_st;
+        T *tmp, *dst;
+        std::size_t n;
+        intrank_t me;
+        
+        my_cb(BinaryOp op, cxs_state_here_t cxs_st):
+          op(std::move(op)),
+          cxs_st(std::move(cxs_st)) {
+        }
+        
+        void execute_and_delete(backend::gasnet::handle_cb_successor) override {
+          std::memcpy((void*)dst, tmp + me*n, n*sizeof(T));
+          std::free(tmp);
+          cxs_st.template operator()<operation_cx_event>();
+          delete this;
+        }
+      };
+      
+      my_cb *cb = new my_cb(std::move(op), cxs_state_here_t{std::forward<Cxs>(cxs)});
+      cb->tmp = static_cast<T*>(detail::alloc_aligned(n*tm.rank_n()*sizeof(T), alignof(T)));
+      cb->dst = dst;
+      cb->n = n;
+      cb->me = tm.rank_me();
+      
+      auto returner = detail::completions_returner<
+          /*EventPredicate=*/detail::event_is_here,
+          /*EventValues=*/detail::reduce_vector_event_values,
+          CxsDecayed
+        >(cb->cxs_st);
+      
+      reduce_one_or_all_trivial_erased(
+          tm, /*all=*/-1,
+          src, cb->tmp,
+          sizeof(T)/detail::reduce_op_best_id<BinaryOp,T>::lanes,
+          n*tm.rank_n()*detail::reduce_op_best_id<BinaryOp,T>::lanes,
+          detail::reduce_op_best_id<BinaryOp,T>::ty_id,
+          detail::reduce_op_best_id<BinaryOp,T>::op_id,
+          detail::reduce_op_best_id<BinaryOp,T>::op_vecfn,
+          (void*)&cb->op,
+          cb
+        );
+      
+      return returner();
+    }
+    
+    // Every rank must make the same choice, so this depends only on the
+    // collective's arguments. `slice_n` is the per-rank block length.
+    template<typename T>
+    bool reduce_use_ring(const team &tm, std::size_t slice_n) {
+      return tm.rank_n() > 1 && slice_n != 0 &&
+             slice_n*sizeof(T) >= backend::gasnet::reduce_ring_min;
+    }
+  }
+  
+  // Each rank contributes `src[0 .. n*tm.rank_n())` and receives in
+  // `dst[0 .. n)` the reduction of the slice starting at `src + n*tm.rank_me()`.
+  template<typename T, typename BinaryOp,
+           typename Cxs = completions<future_cx<operation_cx_event>>>
+  UPCXX_NODISCARD
+  typename detail::completions_returner<
+      /*EventPredicate=*/detail::event_is_here,
+      /*EventValues=*/detail::reduce_vector_event_values,
+      typename std::decay<Cxs>::type
+    >::return_t
+  reduce_scatter(
+      T const *src, T *dst, std::size_t n,
+      BinaryOp op,
+      const team &tm = upcxx::world(),
+      Cxs &&cxs = completions<future_cx<operation_cx_event>>{{}}
+    ) {
+    using CxsDecayed = typename std::decay<Cxs>::type;
+    static_assert(
+      upcxx::is_trivially_serializable<T>::value,
+      "`upcxx::reduce_scatter<T>` only permitted for TriviallySerializable T."
+    );
+    
+    UPCXX_ASSERT_INIT();
+    UPCXX_ASSERT_MASTER();
+    UPCXX_ASSERT_COLLECTIVE_SAFE_NAMED("upcxx::reduce_scatter()", entry_barrier::internal);
+    UPCXX_ASSERT_ALWAYS(
+      (detail::completions_has_event<CxsDecayed, operation_cx_event>::value),
+      "Not requesting operation completion is surely an error."
+    );
+    UPCXX_ASSERT_ALWAYS(
+      (!detail::completions_has_event<CxsDecayed, source_cx_event>::value &&
+       !detail::completions_has_event<CxsDecayed, remote_cx_event>::value),
+      "Reductions do not support source or remote completion."
+    );
+    
+    if(detail::reduce_use_ring<T>(tm, n))
+      return detail::reduce_ring<T,BinaryOp,Cxs>(
+          src, dst, n*tm.rank_n(), /*all=*/false, std::move(op), tm, std::forward<Cxs>(cxs)
+        );
+    else
+      return detail::reduce_scatter_gex<T,BinaryOp,Cxs>(
+          src, dst, n, std::move(op), tm, std::forward<Cxs>(cxs)
+        );
+  }
+  
+  // reduce_all of `buf[0 .. n)` into itself without a second buffer.
+  template<typename T, typename BinaryOp,
+           typename Cxs = completions<future_cx<operation_cx_event>>>
+  UPCXX_NODISCARD
+  typename detail::completions_returner<
+      /*EventPredicate=*/detail::event_is_here,
+      /*EventValues=*/detail::reduce_vector_event_values,
+      typename std::decay<Cxs>::type
+    >::return_t
+  reduce_all_inplace(
+      T *buf, std::size_t n,
+      BinaryOp op,
+      const team &tm = upcxx::world(),
+      Cxs &&cxs = completions<future_cx<operation_cx_event>>{{}}
+    ) {
+    using CxsDecayed = typename std::decay<Cxs>::type;
+    UPCXX_ASSERT_INIT();
+    UPCXX_ASSERT_MASTER();
+    UPCXX_ASSERT_COLLECTIVE_SAFE_NAMED("upcxx::reduce_all_inplace()", entry_barrier::internal);
+    
+    static_assert(
+      upcxx::is_trivially_serializable<T>::value,
+      "`upcxx::reduce_all_inplace<T>` only permitted for TriviallySerializable T."
+    );
+    UPCXX_ASSERT_ALWAYS(
+      (detail::completions_has_event<CxsDecayed, operation_cx_event>::value),
+      "Not requesting operation completion is surely an error."
+    );
+    UPCXX_ASSERT_ALWAYS(
+      (!detail::completions_has_event<CxsDecayed, source_cx_event>::value &&
+       !detail::completions_has_event<CxsDecayed, remote_cx_event>::value),
+      "Reductions do not support source or remote completion."
+    );
+    
+    // GEX reduces in place when src == dst
+    if(!detail::reduce_use_ring<T>(tm, tm.rank_n() > 0 ? n/tm.rank_n() : 0))
+      return detail::reduce_one_or_all_trivial<T,BinaryOp,Cxs>(
+          buf, buf, n, std::move(op), /*all=*/-1, tm, std::forward<Cxs>(cxs)
+        );
+    
+    return detail::reduce_ring<T,BinaryOp,Cxs>(
+        buf, buf, n, /*all=*/true, std::move(op), tm, std::forward<Cxs>(cxs)
+      );
+  }
+  
   //////////////////////////////////////////////////////////////////////////////
   // upcxx::reduce_all_nontrivial
   
@@ -6,6 +6,8 @@
 #include <upcxx/global_ptr.hpp>
 #include <upcxx/serialization.hpp>
 
+#include <cstring>
+
 // For the time being, our implementation of put/get requires the
 // gasnet backend. Ideally we would detect gasnet via UPCXX_BACKEND_GASNET
 // and if not present, rely on a reference implementation over
@@ -99,6 +101,8 @@ namespace upcxx {
       rget_cb_remote<CxStateRemote>,
       backend::gasnet::handle_cb {
       
+      UPCXX_OPNEW_POOLED(rget_cb_byref)
+      
       CxStateHere state_here;
       
       rget_cb_byref(
@@ -125,6 +129,8 @@ namespace upcxx {
       rget_cb_remote<CxStateRemote>,
       backend::gasnet::handle_cb {
 
+      UPCXX_OPNEW_POOLED(rget_cb_byval)
+
       CxStateHere state_here;
       T buffer;
       
@@ -207,6 +213,31 @@ namespace upcxx {
       CxsDecayed>;
     
     using detail::rma_get_done;
+
+    if(backend::rank_is_local(gp_s.rank_)) {
+      // shared-memory bypass: read the value in place, no handle or heap
+      // callback object needed
+      detail::rget_cb_byval<T,cxs_here_t,cxs_remote_t> cb{
+        gp_s.rank_,
+        cxs_here_t{std::forward<Cxs>(cxs)},
+        cxs_remote_t{std::forward<Cxs>(cxs)}
+      };
+
+      auto returner = detail::completions_returner<
+          /*EventPredicate=*/detail::event_is_here,
+          /*EventValues=*/detail::rget_byval_event_values<T>,
+          CxsDecayed
+        >{cb.state_here};
+
+      std::memcpy(
+        &cb.buffer,
+        backend::localize_memory_nonnull(gp_s.rank_, reinterpret_cast<std::uintptr_t>(gp_s.raw_ptr_)),
+        sizeof(T)
+      );
+      cb.send_remote();
+      cb.state_here.template operator()<operation_cx_event>(std::move(cb.buffer));
+      return returner();
+    }
     
     auto *cb = new detail::rget_cb_byval<T,cxs_here_t,cxs_remote_t>{
       gp_s.rank_,
@@ -228,13 +259,13 @@ namespace upcxx {
     
     switch(done) {
     case rma_get_done::none:
-      cb_q.enqueue(cb);
+      cb_q.enqueue(cb, gasnet::handle_cb_class::rma_get);
       gasnet::after_gasnet();
       break;
       
     case rma_get_done::operation:
     default:
-      cb_q.execute_outside(cb);
+      cb_q.execute_outside(cb, gasnet::handle_cb_class::rma_get);
       break;
     }
     
@@ -302,13 +333,25 @@ namespace upcxx {
         CxsDecayed
       >{cb.state_here};
     
-    rma_get_done done = detail::rma_get_nb(
-      buf_d, gp_s.rank_, gp_s.raw_ptr_, n*sizeof(T), &cb
-    );
+    rma_get_done done;
+
+    if(backend::rank_is_local(gp_s.rank_)) {
+      // shared-memory bypass: copy in place and complete below
+      backend::local_copy(
+        buf_d,
+        backend::localize_memory_nonnull(gp_s.rank_, reinterpret_cast<std::uintptr_t>(gp_s.raw_ptr_)),
+        n*sizeof(T)
+      );
+      done = rma_get_done::operation;
+    }
+    else
+      done = detail::rma_get_nb(
+        buf_d, gp_s.rank_, gp_s.raw_ptr_, n*sizeof(T), &cb
+      );
     
     switch(done) {
     case rma_get_done::none:
-      gasnet::register_cb(new decltype(cb)(std::move(cb)));
+      gasnet::register_cb(new decltype(cb)(std::move(cb)), gasnet::handle_cb_class::rma_get);
       gasnet::after_gasnet();
       break;
       
@@ -0,0 +1,257 @@
+#ifndef _6e2b9f1d_0c47_4a35_9d8e_b17a5c3f4e62
+#define _6e2b9f1d_0c47_4a35_9d8e_b17a5c3f4e62
+
+#include <upcxx/backend.hpp>
+#include <upcxx/completion.hpp>
+#include <upcxx/future.hpp>
+#include <upcxx/global_ptr.hpp>
+#include <upcxx/rget.hpp>
+#include <upcxx/rput.hpp>
+
+#include <upcxx/backend/gasnet/runtime.hpp>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+// Chunked bulk transfers: one logical rput or rget is split into chunks, and
+// at most a window's worth of them is in flight at once. The source side of a
+// put learns chunk by chunk when its buffer may be reused, and a producer can
+// fill each chunk just before it is sent, so very large transfers need
+// neither the whole payload in memory nor wait for a single source
+// completion at the end. Completions of the individual chunks arrive as lpc's
+// on the initiating persona, so the transfer only advances during its user
+// progress. The returned future becomes ready once every chunk has completed.
+
+namespace upcxx {
+  // Chunking parameters, zero means the runtime default.
+  struct rma_chunking {
+    // Bytes per chunk, rounded down to whole elements (UPCXX_RMA_CHUNK_SIZE).
+    std::size_t chunk_bytes = 0;
+    // Maximum number of chunks in flight (UPCXX_RMA_CHUNK_WINDOW).
+    int window = 0;
+  };
+
+  namespace detail {
+    struct rma_chunk_nop {
+      template<typename ...T>
+      void operator()(T&&...) const {}
+    };
+
+    template<typename T>
+    std::size_t rma_chunk_elts(rma_chunking const &opts) {
+      std::size_t bytes = opts.chunk_bytes != 0
+        ? opts.chunk_bytes
+        : backend::gasnet::rma_chunk_size;
+      return std::max<std::size_t>(1, bytes/sizeof(T));
+    }
+
+    inline int rma_chunk_window(rma_chunking const &opts) {
+      int w = opts.window != 0 ? opts.window : backend::gasnet::rma_chunk_window;
+      return std::max(1, w);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // rma_chunked_state: Shared state of a chunked transfer, lives until the
+    // last chunk completes.
+
+    template<typename Derived>
+    struct rma_chunked_state {
+      persona *per = &upcxx::current_persona();
+      promise<> pro;
+      std::size_t n, chunk, next = 0;
+      int window, inflight = 0;
+
+      rma_chunked_state(std::size_t n, std::size_t chunk, int window):
+        n(n), chunk(chunk), window(window) {
+      }
+
+      // Issue chunks until the window is full or the data runs out.
+      void pump() {
+        Derived *me = static_cast<Derived*>(this);
+
+        while(inflight < window && next < n && me->ready_to_issue()) {
+          std::size_t off = next;
+          std::size_t cnt = std::min(chunk, n - off);
+          next += cnt;
+          inflight += 1;
+          me->issue(off, cnt);
+        }
+      }
+
+      void chunk_done() {
+        inflight -= 1;
+        if(next == n && inflight == 0) {
+          pro.fulfill_anonymous(1);
+          delete static_cast<Derived*>(this);
+        }
+        else
+          pump();
+      }
+
+      future<> start() {
+        future<> ans = pro.get_future();
+        if(n == 0) {
+          pro.fulfill_anonymous(1);
+          delete static_cast<Derived*>(this);
+        }
+        else
+          pump();
+        return ans;
+      }
+    };
+
+    template<typename T, typename OnSource>
+    struct rput_chunked_state final:
+        rma_chunked_state<rput_chunked_state<T,OnSource>> {
+      T const *buf_s;
+      global_ptr<T> gp_d;
+      OnSource on_source;
+
+      rput_chunked_state(T const *buf_s, global_ptr<T> gp_d, std::size_t n,
+                         OnSource &&on_source, rma_chunking const &opts):
+        rma_chunked_state<rput_chunked_state>(n, rma_chunk_elts<T>(opts), rma_chunk_window(opts)),
+        buf_s(buf_s), gp_d(gp_d),
+        on_source(std::move(on_source)) {
+      }
+
+      bool ready_to_issue() const { return true; }
+
+      void issue(std::size_t off, std::size_t cnt) {
+        upcxx::rput(buf_s + off, gp_d + off, cnt,
+          source_cx::as_lpc(*this->per, [=]() { this->on_source(off, cnt); }) |
+          operation_cx::as_lpc(*this->per, [=]() { this->chunk_done(); })
+        );
+      }
+    };
+
+    template<typename T, typename Fill>
+    struct rput_stream_state final:
+        rma_chunked_state<rput_stream_state<T,Fill>> {
+      global_ptr<T> gp_d;
+      Fill fill;
+      // window many chunks, T need not be default constructible
+      std::vector<typename std::aligned_storage<sizeof(T), alignof(T)>::type> bufs;
+      std::vector<T*> idle; // chunk buffers not awaiting source completion
+
+      rput_stream_state(global_ptr<T> gp_d, std::size_t n,
+                        Fill &&fill, rma_chunking const &opts):
+        rma_chunked_state<rput_stream_state>(n, rma_chunk_elts<T>(opts), rma_chunk_window(opts)),
+        gp_d(gp_d),
+        fill(std::move(fill)) {
+
+        std::size_t chunk = std::min(this->chunk, n);
+        int window = int(std::min<std::size_t>(this->window, (n + this->chunk-1)/this->chunk));
+        if(chunk != 0) {
+          bufs.resize(chunk*window);
+          for(int i=0; i < window; i++)
+            idle.push_back(reinterpret_cast<T*>(&bufs[i*chunk]));
+        }
+      }
+
+      bool ready_to_issue() const { return !idle.empty(); }
+
+      void issue(std::size_t off, std::size_t cnt) {
+        T *buf = idle.back();
+        idle.pop_back();
+
+        fill(buf, off, cnt);
+
+        upcxx::rput(buf, gp_d + off, cnt,
+          source_cx::as_lpc(*this->per, [=]() {
+            this->idle.push_back(buf);
+            this->pump();
+          }) |
+          operation_cx::as_lpc(*this->per, [=]() { this->chunk_done(); })
+        );
+      }
+    };
+
+    template<typename T, typename OnChunk>
+    struct rget_chunked_state final:
+        rma_chunked_state<rget_chunked_state<T,OnChunk>> {
+      global_ptr<const T> gp_s;
+      T *buf_d;
+      OnChunk on_chunk;
+
+      rget_chunked_state(global_ptr<const T> gp_s, T *buf_d, std::size_t n,
+                         OnChunk &&on_chunk, rma_chunking const &opts):
+        rma_chunked_state<rget_chunked_state>(n, rma_chunk_elts<T>(opts), rma_chunk_window(opts)),
+        gp_s(gp_s), buf_d(buf_d),
+        on_chunk(std::move(on_chunk)) {
+      }
+
+      bool ready_to_issue() const { return true; }
+
+      void issue(std::size_t off, std::size_t cnt) {
+        upcxx::rget(gp_s + off, buf_d + off, cnt,
+          operation_cx::as_lpc(*this->per, [=]() {
+            this->on_chunk(off, cnt);
+            this->chunk_done();
+          })
+        );
+      }
+    };
+
+    template<typename T>
+    void rma_chunked_assert_sane() {
+      static_assert(
+        is_trivially_serializable<T>::value,
+        "RMA operations only work on TriviallySerializable types."
+      );
+    }
+  }
+
+  // Put `n` elements from `buf_s` in chunks. `on_source(offset, count)` runs
+  // once the elements `[offset, offset+count)` of `buf_s` may be overwritten.
+  template<typename T, typename OnSource = detail::rma_chunk_nop>
+  UPCXX_NODISCARD
+  future<> rput_chunked(T const *buf_s, global_ptr<T> gp_d, std::size_t n,
+                        OnSource on_source = OnSource(),
+                        rma_chunking opts = rma_chunking()) {
+    detail::rma_chunked_assert_sane<T>();
+    UPCXX_ASSERT_INIT();
+    UPCXX_GPTR_CHK(gp_d);
+    UPCXX_ASSERT(buf_s && gp_d, "pointer arguments to rput_chunked may not be null");
+
+    return (new detail::rput_chunked_state<T,OnSource>(
+        buf_s, gp_d, n, std::move(on_source), opts
+      ))->start();
+  }
+
+  // Put `n` elements produced on demand. `fill(buf, offset, count)` must write
+  // elements `[offset, offset+count)` of the logical source into `buf`, which
+  // is one of `window` chunk buffers owned by the runtime and recycled as
+  // soon as its previous contents have been sent.
+  template<typename T, typename Fill>
+  UPCXX_NODISCARD
+  future<> rput_stream(global_ptr<T> gp_d, std::size_t n, Fill fill,
+                       rma_chunking opts = rma_chunking()) {
+    detail::rma_chunked_assert_sane<T>();
+    UPCXX_ASSERT_INIT();
+    UPCXX_GPTR_CHK(gp_d);
+    UPCXX_ASSERT(gp_d, "pointer arguments to rput_stream may not be null");
+
+    return (new detail::rput_stream_state<T,Fill>(
+        gp_d, n, std::move(fill), opts
+      ))->start();
+  }
+
+  // Get `n` elements into `buf_d` in chunks. `on_chunk(offset, count)` runs
+  // once the elements `[offset, offset+count)` of `buf_d` have arrived.
+  template<typename T, typename OnChunk = detail::rma_chunk_nop>
+  UPCXX_NODISCARD
+  future<> rget_chunked(global_ptr<const T> gp_s, T *buf_d, std::size_t n,
+                        OnChunk on_chunk = OnChunk(),
+                        rma_chunking opts = rma_chunking()) {
+    detail::rma_chunked_assert_sane<T>();
+    UPCXX_ASSERT_INIT();
+    UPCXX_GPTR_CHK(gp_s);
+    UPCXX_ASSERT(gp_s && buf_d, "pointer arguments to rget_chunked may not be null");
+
+    return (new detail::rget_chunked_state<T,OnChunk>(
+        gp_s, buf_d, n, std::move(on_chunk), opts
+      ))->start();
+  }
+}
+#endif
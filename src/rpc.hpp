@@ -135,7 +135,7 @@ namespace upcxx {
     UPCXX_ASSERT(recipient >= 0 && recipient < world().rank_n(),
       "rpc_ff(recipient, ...) requires recipient in [0, rank_n()-1] == [0, " << world().rank_n()-1 << "], but given: " << recipient);
 
-    backend::template send_am_master<progress_level::user>( recipient,
+    backend::template send_am_master_aggr<progress_level::user>( recipient,
       upcxx::bind_rvalue_as_lvalue(std::forward<Fn>(fn), std::forward<Arg>(args)...)
     );
   }
@@ -220,7 +220,7 @@ namespace upcxx {
         CxsDecayed
       >{state};
     
-    backend::template send_am_master<progress_level::user>( recipient,
+    backend::template send_am_master_aggr<progress_level::user>( recipient,
       upcxx::bind_rvalue_as_lvalue(std::forward<Fn>(fn), std::forward<Arg>(args)...)
     );
     
@@ -384,7 +384,7 @@ namespace upcxx {
       
       using fn_bound_t = typename detail::bind<const Fn&, const Arg&...>::return_type;
 
-      backend::template send_am_master<progress_level::user>(
+      backend::template send_am_master_aggr<progress_level::user>(
         recipient,
         upcxx::bind_rvalue_as_lvalue(
           [=](deserialized_type_t<fn_bound_t> &&fn_bound) {
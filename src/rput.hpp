@@ -375,6 +375,8 @@ namespace upcxx {
     struct rput_obj final:
       detail::rput_obj_base<rput_obj<Cxs,Traits>, Traits> {
 
+      UPCXX_OPNEW_POOLED(rput_obj)
+
       typename Traits::cx_state_here_t cx_state_here;
       
       rput_obj(Cxs &&cxs):
@@ -420,10 +422,59 @@ namespace upcxx {
         first_cb = o->the_src_cb(/*otherwise=*/o->the_op_cb());
       
       if(first_cb != nullptr) // this nullness is always statically known, i'm trusting optimizer to see that
-        backend::gasnet::register_cb(first_cb);
+        backend::gasnet::register_cb(first_cb, backend::gasnet::handle_cb_class::rma_put);
       
       backend::gasnet::after_gasnet();
     }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // rma_put_local: Shared-memory bypass for puts into memory we can address
+    // directly (the destination has already been localized). The copy happens
+    // in place, so there is no gasnet handle or heap callback object, and the
+    // source and operation events are both signaled before returning. The
+    // `Copy` overload lets callers supply their own copy loop (see
+    // "./vis.hpp").
+
+    template<typename EventValues, typename Cxs, typename Copy>
+    typename detail::completions_returner<
+        /*EventPredicate=*/detail::event_is_here,
+        EventValues,
+        typename std::decay<Cxs>::type
+      >::return_t
+    rma_put_local(Copy &&copy, Cxs &&cxs) {
+      using CxsDecayed = typename std::decay<Cxs>::type;
+
+      detail::completions_state<
+          /*EventPredicate=*/detail::event_is_here,
+          EventValues,
+          CxsDecayed
+        > cx_state_here(std::forward<Cxs>(cxs));
+
+      detail::completions_returner<
+          /*EventPredicate=*/detail::event_is_here,
+          EventValues,
+          CxsDecayed
+        > returner(cx_state_here);
+
+      copy();
+
+      cx_state_here.template operator()<source_cx_event>();
+      cx_state_here.template operator()<operation_cx_event>();
+      return returner();
+    }
+
+    template<typename EventValues, typename Cxs>
+    typename detail::completions_returner<
+        /*EventPredicate=*/detail::event_is_here,
+        EventValues,
+        typename std::decay<Cxs>::type
+      >::return_t
+    rma_put_local(void *buf_d, void const *buf_s, std::size_t size, Cxs &&cxs) {
+      return detail::template rma_put_local<EventValues>(
+        [=]() { backend::local_copy(buf_d, buf_s, size); },
+        std::forward<Cxs>(cxs)
+      );
+    }
   } // namespace detail
 
   ////////////////////////////////////////////////////////////////////////////
@@ -451,6 +502,14 @@ namespace upcxx {
       (!detail::completions_has_event<CxsDecayed, source_cx_event>::value),
       "Scalar rput does not support source completion."
     );
+
+    // remote completions take the active message path, which does its own
+    // local bypass
+    if(!traits_t::want_remote && backend::rank_is_local(gp_d.rank_))
+      return detail::template rma_put_local<detail::rput_event_values>(
+        backend::localize_memory_nonnull(gp_d.rank_, reinterpret_cast<std::uintptr_t>(gp_d.raw_ptr_)),
+        &value_s, sizeof(T), std::forward<Cxs>(cxs)
+      );
     
     object_t *o = new object_t(std::forward<Cxs>(cxs));
     
@@ -487,6 +546,12 @@ namespace upcxx {
     UPCXX_ASSERT_INIT();
     UPCXX_GPTR_CHK(gp_d);
     UPCXX_ASSERT(buf_s && gp_d, "pointer arguments to rput may not be null");
+
+    if(!traits_t::want_remote && backend::rank_is_local(gp_d.rank_))
+      return detail::template rma_put_local<detail::rput_event_values>(
+        backend::localize_memory_nonnull(gp_d.rank_, reinterpret_cast<std::uintptr_t>(gp_d.raw_ptr_)),
+        buf_s, n*sizeof(T), std::forward<Cxs>(cxs)
+      );
     
     object_t *o = new object_t(std::forward<Cxs>(cxs));
     
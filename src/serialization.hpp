@@ -2008,13 +2008,34 @@ namespace upcxx {
 
       using deserialized_type = BagOut;
 
+    private:
+      // Trivially serialized elements are range-inserted straight out of the
+      // buffer as one bulk copy instead of being read one at a time.
+      template<typename Reader>
+      static void read_elts(Reader &r, BagOut &bag, std::size_t n, std::true_type trivial_serz) {
+        if(n != 0) {
+          T1 const *p = static_cast<T1 const*>(r.unplace(storage_size_of<T1>().arrayed(n)));
+          bag.insert(bag.end(), p, p + n);
+        }
+      }
+
+      template<typename Reader>
+      static void read_elts(Reader &r, BagOut &bag, std::size_t n, std::false_type trivial_serz) {
+        r.template read_sequence_into_iterator<T0>(detail::template inserter<BagOut>()(bag), n);
+      }
+
+    public:
       template<typename Reader>
       static BagOut* deserialize(Reader &r, void *raw) {
         typename BagOut::allocator_type a = r.template read<typename BagIn::allocator_type>();
         std::size_t n = r.template read_trivial<std::size_t>();
         BagOut *bag = ::new(raw) BagOut(std::move(a));
         detail::template reserve_if_supported<BagOut>()(*bag, n);
-        r.template read_sequence_into_iterator<T0>(detail::template inserter<BagOut>()(*bag), n);
+        read_elts(r, *bag, n,
+          std::integral_constant<bool,
+            serialization_traits<T0>::is_actually_trivially_serializable &&
+            std::is_same<T0, T1>::value
+          >());
         return bag;
       }
 
@@ -0,0 +1,11 @@
+#include <upcxx/task_pool_fwd.hpp>
+
+namespace detail = upcxx::detail;
+
+__thread detail::task_pool_worker *detail::the_task_pool_worker = nullptr;
+
+void detail::task_pool_idle() {
+  task_pool_worker *w = the_task_pool_worker;
+  if(w != nullptr)
+    w->run_one();
+}
@@ -0,0 +1,379 @@
+#ifndef _61636270_effd_4211_b531_1e8accbebfcc
+#define _61636270_effd_4211_b531_1e8accbebfcc
+
+#include <upcxx/backend.hpp>
+#include <upcxx/barrier.hpp>
+#include <upcxx/dist_object.hpp>
+#include <upcxx/future.hpp>
+#include <upcxx/reduce.hpp>
+#include <upcxx/rpc.hpp>
+#include <upcxx/task_pool_fwd.hpp>
+#include <upcxx/team.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace upcxx {
+  namespace detail {
+    ////////////////////////////////////////////////////////////////////////////
+    // ws_deque: Chase-Lev work-stealing deque, in the C11 formulation of Le,
+    // Pop, Cohen and Zappa Nardelli (PPoPP'13). The owning thread pushes and
+    // pops at the bottom, any thread steals from the top. T must be a type
+    // std::atomic handles lock-free, in practice a pointer. Outgrown rings
+    // are kept until the deque dies since a thief may still be reading one.
+
+    template<typename T>
+    class ws_deque {
+      struct ring {
+        std::int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> buf;
+        ring *prev;
+
+        ring(std::int64_t cap, ring *prev):
+          mask(cap-1),
+          buf(new std::atomic<T>[cap]),
+          prev(prev) {
+        }
+
+        T get(std::int64_t i) const {
+          return buf[i & mask].load(std::memory_order_relaxed);
+        }
+        void put(std::int64_t i, T x) {
+          buf[i & mask].store(x, std::memory_order_relaxed);
+        }
+      };
+
+      std::atomic<std::int64_t> top_{0}, bottom_{0};
+      std::atomic<ring*> ring_;
+
+    public:
+      ws_deque():
+        ring_(new ring(64, nullptr)) {
+      }
+      ws_deque(ws_deque const&) = delete;
+
+      ~ws_deque() {
+        ring *r = ring_.load(std::memory_order_relaxed);
+        while(r != nullptr) {
+          ring *prev = r->prev;
+          delete r;
+          r = prev;
+        }
+      }
+
+      // Approximate when other threads are active.
+      std::int64_t size() const {
+        std::int64_t n = bottom_.load(std::memory_order_relaxed) - top_.load(std::memory_order_relaxed);
+        return n > 0 ? n : 0;
+      }
+
+      // Owner only.
+      void push(T x) {
+        std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        ring *r = ring_.load(std::memory_order_relaxed);
+
+        if(b - t > r->mask) {
+          ring *bigger = new ring(2*(r->mask + 1), r);
+          for(std::int64_t i=t; i < b; i++)
+            bigger->put(i, r->get(i));
+          ring_.store(bigger, std::memory_order_release);
+          r = bigger;
+        }
+
+        r->put(b, x);
+        bottom_.store(b + 1, std::memory_order_release);
+      }
+
+      // Owner only.
+      bool pop(T &x) {
+        std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        ring *r = ring_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+
+        if(t > b) { // empty
+          bottom_.store(b + 1, std::memory_order_relaxed);
+          return false;
+        }
+
+        x = r->get(b);
+        if(t == b) { // last one, race thieves for it
+          bool won = top_.compare_exchange_strong(t, t + 1,
+            std::memory_order_seq_cst, std::memory_order_relaxed);
+          bottom_.store(b + 1, std::memory_order_relaxed);
+          return won;
+        }
+        return true;
+      }
+
+      // Any thread. May fail spuriously when racing another thread.
+      bool steal(T &x) {
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = bottom_.load(std::memory_order_acquire);
+
+        if(t >= b)
+          return false;
+
+        ring *r = ring_.load(std::memory_order_acquire);
+        x = r->get(t);
+        return top_.compare_exchange_strong(t, t + 1,
+          std::memory_order_seq_cst, std::memory_order_relaxed);
+      }
+    };
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // task_pool: Load-balanced execution of tasks of type T, each processed by
+  // `handler(pool, task)` which may spawn() further tasks. Every rank of the
+  // team calls run() from its master persona's thread, and up to
+  // `workers-1` further threads per rank may call run() to help.
+  //
+  // Each thread owns a Chase-Lev deque: it works LIFO from its own and
+  // steals FIFO from its siblings'. A rank which runs dry sends RPCs asking
+  // other ranks, round robin, to hand over half their queued tasks, so T
+  // must be Serializable. Termination is detected with waves of
+  // reduce_all() over spawned and completed counts: two consecutive waves
+  // agreeing that everything spawned has completed end run() everywhere.
+  //
+  // While a thread is in run(), a user-level progress() on it which found
+  // nothing else to do executes one task. Construction is collective, and
+  // run() may be called once. Helper threads must be joined before the pool
+  // is destroyed.
+
+  template<typename T>
+  class task_pool {
+  public:
+    using handler_type = std::function<void(task_pool&, T&&)>;
+
+  private:
+    struct worker final: detail::task_pool_worker {
+      task_pool *me;
+
+      bool run_one() override {
+        if(this->busy)
+          return false;
+        this->busy = true;
+        bool ran = me->run_one(this->slot);
+        this->busy = false;
+        return ran;
+      }
+    };
+
+    handler_type handler_;
+    const upcxx::team *tm_;
+    int workers_;
+    std::unique_ptr<detail::ws_deque<T*>[]> deques_; // by worker slot, master is 0
+
+    std::atomic<int> next_slot_{1};
+    std::atomic<std::int64_t> live_{0}; // tasks on this rank, queued or running
+    std::atomic<std::uint64_t> spawned_{0}, completed_{0};
+    std::atomic<bool> done_{false};
+
+    dist_object<task_pool*> self_;
+
+    // Only touched by the master thread:
+    intrank_t victim_;
+    int steal_fails_ = 0;
+    bool steal_pending_ = false;
+    bool wave_pending_ = false;
+    bool wave_prev_quiet_ = false;
+    std::uint64_t wave_prev_spawned_ = 0;
+    std::uint64_t wave_src_[2], wave_dst_[2]; // {spawned, completed}
+    future<> wave_;
+
+    static constexpr int progress_period = 64; // tasks between master progress calls
+    static constexpr std::size_t give_max = 1024; // tasks per remote steal
+
+    int slot_of_caller() const {
+      detail::task_pool_worker *w = detail::the_task_pool_worker;
+      if(w != nullptr && w->pool == this)
+        return w->slot;
+      UPCXX_ASSERT(backend::master.active_with_caller(),
+        "task_pool::spawn() may only be called from inside run() or with the master persona");
+      return 0;
+    }
+
+    bool run_one(int slot) {
+      T *t;
+      bool got = deques_[slot].pop(t);
+      for(int k=1; !got && k < workers_; k++)
+        got = deques_[(slot + k) % workers_].steal(t);
+      if(!got)
+        return false;
+
+      handler_(*this, std::move(*t));
+      delete t;
+
+      completed_.fetch_add(1, std::memory_order_relaxed);
+      live_.fetch_sub(1, std::memory_order_release);
+      return true;
+    }
+
+    // Victim side of a remote steal, on the master persona.
+    std::vector<T> give() {
+      std::vector<T> out;
+      if(done_.load(std::memory_order_acquire))
+        return out;
+
+      std::int64_t queued = 0;
+      for(int s=0; s < workers_; s++)
+        queued += deques_[s].size();
+
+      std::size_t want = std::min(std::size_t(give_max), std::size_t(queued + 1)/2);
+      for(int s=0; s < workers_ && out.size() < want; s++) {
+        T *t;
+        while(out.size() < want && deques_[s].steal(t)) {
+          out.push_back(std::move(*t));
+          delete t;
+        }
+      }
+
+      live_.fetch_sub(out.size(), std::memory_order_relaxed);
+      return out;
+    }
+
+    void steal_remote() {
+      intrank_t n = tm_->rank_n();
+      victim_ = (victim_ + 1) % n;
+      if(victim_ == tm_->rank_me())
+        victim_ = (victim_ + 1) % n;
+
+      steal_pending_ = true;
+      upcxx::rpc(*tm_, victim_,
+        [](dist_object<task_pool*> &pool) {
+          return (*pool)->give();
+        },
+        self_
+      ).then(
+        [this](std::vector<T> const &got) {
+          for(T const &x: got) {
+            live_.fetch_add(1, std::memory_order_relaxed);
+            deques_[0].push(new T(x));
+          }
+          steal_fails_ = got.empty() ? steal_fails_ + 1 : 0;
+          steal_pending_ = false;
+        }
+      );
+    }
+
+    void start_wave() {
+      wave_src_[0] = spawned_.load(std::memory_order_relaxed);
+      wave_src_[1] = completed_.load(std::memory_order_relaxed);
+      wave_ = upcxx::reduce_all(wave_src_, wave_dst_, 2, upcxx::op_fast_add, *tm_);
+      wave_pending_ = true;
+      steal_fails_ = 0;
+    }
+
+    // One round of the master's loop when its own slot found no task.
+    void master_idle() {
+      upcxx::progress();
+
+      if(wave_pending_ && wave_.ready()) {
+        wave_pending_ = false;
+        bool quiet = wave_dst_[0] == wave_dst_[1];
+        bool done = quiet && wave_prev_quiet_ && wave_dst_[0] == wave_prev_spawned_;
+        wave_prev_quiet_ = quiet;
+        wave_prev_spawned_ = wave_dst_[0];
+
+        if(done) {
+          UPCXX_ASSERT(live_.load() == 0, "task_pool terminated with tasks remaining");
+          done_.store(true, std::memory_order_release);
+          return;
+        }
+      }
+
+      if(live_.load(std::memory_order_acquire) != 0)
+        return;
+
+      intrank_t n = tm_->rank_n();
+      if(n > 1 && !steal_pending_)
+        steal_remote();
+
+      if(!wave_pending_ && steal_fails_ >= n - 1)
+        start_wave();
+    }
+
+  public:
+    // Collective over `tm`. `workers` bounds the threads per rank in run().
+    task_pool(handler_type handler, const upcxx::team &tm = upcxx::world(), int workers = 1):
+      handler_(std::move(handler)),
+      tm_(&tm),
+      workers_(workers),
+      deques_(new detail::ws_deque<T*>[workers]),
+      self_(this, tm),
+      victim_(tm.rank_me()) {
+      UPCXX_ASSERT_ALWAYS(workers >= 1, "task_pool: workers must be at least 1");
+    }
+
+    task_pool(task_pool const&) = delete;
+
+    ~task_pool() {
+      for(int s=0; s < workers_; s++) {
+        T *t;
+        while(deques_[s].pop(t))
+          delete t;
+      }
+    }
+
+    upcxx::team& team() { return *const_cast<upcxx::team*>(tm_); }
+    const upcxx::team& team() const { return *tm_; }
+
+    // Queue a task on the calling thread's deque.
+    void spawn(T task) {
+      int slot = slot_of_caller();
+      spawned_.fetch_add(1, std::memory_order_relaxed);
+      live_.fetch_add(1, std::memory_order_relaxed);
+      deques_[slot].push(new T(std::move(task)));
+    }
+
+    // Execute tasks until every task on every rank has completed.
+    // Collective over the team for the master persona's thread.
+    void run() {
+      UPCXX_ASSERT_INIT();
+      bool master = backend::master.active_with_caller();
+
+      worker w;
+      w.pool = this;
+      w.slot = master ? 0 : next_slot_.fetch_add(1);
+      w.busy = false;
+      w.me = this;
+      UPCXX_ASSERT_ALWAYS(w.slot < workers_,
+        "task_pool::run() called by more threads than the pool has workers (" << workers_ << ")");
+
+      detail::task_pool_worker *outer = detail::the_task_pool_worker;
+      detail::the_task_pool_worker = &w;
+
+      int since_progress = 0;
+      while(!done_.load(std::memory_order_acquire)) {
+        if(w.run_one()) {
+          if(master && ++since_progress == progress_period) {
+            since_progress = 0;
+            upcxx::progress();
+          }
+        }
+        else if(master)
+          master_idle();
+        else
+          std::this_thread::yield();
+      }
+
+      detail::the_task_pool_worker = outer;
+
+      if(master) {
+        // no steal may still be in flight to or from a pool about to die
+        while(steal_pending_)
+          upcxx::progress();
+        upcxx::barrier(*tm_);
+      }
+    }
+  };
+}
+#endif
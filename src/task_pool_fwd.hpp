@@ -0,0 +1,25 @@
+#ifndef _0d6b2c1e_93a4_4f7b_8e25_5c7f3a9d1b46
+#define _0d6b2c1e_93a4_4f7b_8e25_5c7f3a9d1b46
+
+namespace upcxx {
+  namespace detail {
+    ////////////////////////////////////////////////////////////////////////////
+    // The thread-local view of a thread inside task_pool::run(). progress()
+    // at user level uses it to execute a task when it found nothing else to
+    // do, unless the thread is already inside a task.
+
+    struct task_pool_worker {
+      void const *pool;
+      int slot;
+      bool busy;
+
+      virtual bool run_one() = 0;
+    };
+
+    extern __thread task_pool_worker *the_task_pool_worker;
+
+    // Called by progress(progress_level::user) when it executed nothing.
+    void task_pool_idle();
+  }
+}
+#endif
@@ -2,6 +2,8 @@
 
 #include <upcxx/backend/gasnet/runtime_internal.hpp>
 
+#include <deque>
+
 using namespace std;
 
 namespace detail = upcxx::detail;
@@ -15,6 +17,206 @@ raw_storage<team> detail::the_world_team;
 raw_storage<team> detail::the_local_team;
 
 std::unordered_map<upcxx::digest, void*> upcxx::detail::registry;
+upcxx::detail::dist_slot upcxx::detail::dist_slots[upcxx::detail::dist_slot_n];
+
+namespace {
+  //////////////////////////////////////////////////////////////////////////////
+  // Team scratch pool
+  //
+  // Every TM needs a scratch area in the segment. Codes which churn through
+  // many short lived teams would otherwise pay a heap allocation and free per
+  // team, so scratch of destroyed teams is kept for reuse.
+  
+  struct scratch_buf {
+    void *buf;
+    size_t size;
+  };
+
+  constexpr size_t scratch_pool_max = 16;
+  std::vector<scratch_buf> scratch_pool;
+  // scratch currently held by teams, mapped to its size
+  std::unordered_map<void*, size_t> scratch_live;
+  
+  scratch_buf scratch_acquire(size_t size) {
+    scratch_buf got = {nullptr, 0};
+    size_t best_i = scratch_pool.size();
+    
+    for(size_t i=0; i != scratch_pool.size(); i++) {
+      if(size <= scratch_pool[i].size &&
+         (best_i == scratch_pool.size() || scratch_pool[i].size < scratch_pool[best_i].size))
+        best_i = i;
+    }
+    
+    if(best_i != scratch_pool.size()) {
+      got = scratch_pool[best_i];
+      scratch_pool[best_i] = scratch_pool.back();
+      scratch_pool.pop_back();
+    }
+    else {
+      got.buf = gasnet::allocate(size, GASNET_PAGESIZE, &gasnet::sheap_footprint_misc);
+      got.size = size;
+      UPCXX_ASSERT_ALWAYS(got.buf != nullptr,
+        "Out of shared memory allocating "<<size<<" bytes of team scratch space.");
+    }
+    
+    scratch_live[got.buf] = got.size;
+    return got;
+  }
+
+  // Returns false if `buf` did not come from scratch_acquire().
+  bool scratch_release(void *buf) {
+    auto it = scratch_live.find(buf);
+    if(it == scratch_live.end())
+      return false;
+
+    scratch_buf sb = {it->first, it->second};
+    scratch_live.erase(it);
+
+    if(scratch_pool.size() < scratch_pool_max)
+      scratch_pool.push_back(sb);
+    else
+      gasnet::deallocate(sb.buf, &gasnet::sheap_footprint_misc);
+    return true;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Deferred team construction
+  //
+  // GEX TM construction is a blocking collective over the parent, and GASNet
+  // offers no non-blocking form. Each parent lazily gets a private duplicate
+  // TM used for nothing but constructions, so running them out of line with
+  // the parent's own collectives cannot reorder anything GASNet sees.
+  // Constructions against all parents share one queue in issue order, which
+  // by the collective ordering rules is the same order on every rank. Only
+  // the head of the queue is in flight: a non-blocking barrier over its
+  // parent's duplicate is issued, and once that completes (all members have
+  // issued the same construction) the blocking GEX call is made from a
+  // user-level progress step of the master persona, never from within a
+  // handle callback. Every rank thus enters the blocking calls one at a time
+  // and in the same order, with all members of each already there.
+
+  struct construct_state {
+    gex_TM_t dup_tm;
+    size_t pending = 0; // ops against this parent in `construct_q`
+  };
+
+  // keyed by parent team id (stable under team moves)
+  std::unordered_map<digest, construct_state*> construct_states;
+
+  struct construct_op {
+    digest id;
+    construct_state *st;
+    upcxx::promise<team> pro;
+
+    construct_op(digest id): id(id) {}
+    virtual ~construct_op() {}
+    
+    // Blocking collective over `dup_tm`. Returns the new TM (or
+    // GEX_TM_INVALID if not a member) with its scratch attached as CData.
+    virtual gex_TM_t construct(gex_TM_t dup_tm) = 0;
+  };
+
+  // all parents, head has its barrier in flight
+  std::deque<construct_op*> construct_q;
+
+  void construct_issue_head();
+
+  // Runs the head of `construct_q` once its barrier is done.
+  void construct_step() {
+    construct_op *op = construct_q.front();
+    construct_q.pop_front();
+    
+    gex_TM_t sub_tm = op->construct(op->st->dup_tm);
+    bool member = sub_tm != GEX_TM_INVALID;
+    op->st->pending -= 1;
+
+    backend::fulfill_during<upcxx::progress_level::user>(
+      std::move(detail::promise_as_shref(op->pro)).steal_header(),
+      std::tuple<team>(team(
+        detail::internal_only(),
+        backend::team_base{reinterpret_cast<uintptr_t>(sub_tm)},
+        op->id,
+        member ? (intrank_t)gex_TM_QuerySize(sub_tm) : 0,
+        member ? (intrank_t)gex_TM_QueryRank(sub_tm) : -1
+      )),
+      backend::master
+    );
+    delete op;
+
+    if(!construct_q.empty())
+      construct_issue_head();
+  }
+
+  struct construct_cb final: gasnet::handle_cb {
+    construct_cb(gex_TM_t dup_tm) {
+      this->handle = reinterpret_cast<uintptr_t>(gex_Coll_BarrierNB(dup_tm, 0));
+    }
+    
+    void execute_and_delete(gasnet::handle_cb_successor) override {
+      // Leave the blocking construction to user-level progress, where it
+      // cannot stall other handle callbacks.
+      detail::the_persona_tls.defer(
+        backend::master, upcxx::progress_level::user, []() { construct_step(); }
+      );
+      delete this;
+    }
+  };
+
+  void construct_issue_head() {
+    gasnet::register_cb(
+      new construct_cb(construct_q.front()->st->dup_tm),
+      gasnet::handle_cb_class::coll
+    );
+    gasnet::after_gasnet();
+  }
+
+  future<team> construct_enqueue(team const &parent, construct_op *op) {
+    construct_state *&st = construct_states[parent.id().dig_];
+    
+    if(st == nullptr) {
+      // Duplicating the parent is itself a blocking collective, made in the
+      // caller's issue order on the first deferred construction against it.
+      gex_TM_t tm = gasnet::handle_of(parent);
+      size_t scratch_sz = gex_TM_Split(
+        nullptr, tm, 0, parent.rank_me(), nullptr, 0,
+        GEX_FLAG_TM_SCRATCH_SIZE_RECOMMENDED
+      );
+      scratch_buf scratch = scratch_acquire(scratch_sz);
+      
+      st = new construct_state;
+      gex_TM_Split(&st->dup_tm, tm, 0, parent.rank_me(), scratch.buf, scratch.size, 0);
+      gex_TM_SetCData(st->dup_tm, scratch.buf);
+    }
+
+    future<team> ans = op->pro.get_future();
+    
+    op->st = st;
+    st->pending += 1;
+    construct_q.push_back(op);
+    if(construct_q.size() == 1)
+      construct_issue_head();
+    
+    return ans;
+  }
+
+  void construct_state_destroy(team const &parent) {
+    auto it = construct_states.find(parent.id().dig_);
+    if(it == construct_states.end())
+      return;
+    
+    construct_state *st = it->second;
+    construct_states.erase(it);
+    
+    UPCXX_ASSERT_ALWAYS(st->pending == 0,
+      "team::destroy() called while split_async() or create() against the team is still in progress.");
+    
+    void *scratch = gex_TM_QueryCData(st->dup_tm);
+    gex_Memvec_t scratch_area;
+    gex_TM_Destroy(st->dup_tm, &scratch_area, GEX_FLAG_GLOBALLY_QUIESCED);
+    scratch_release(scratch);
+    delete st;
+  }
+}
 
 team::team(detail::internal_only, backend::team_base &&base, digest id, intrank_t n, intrank_t me):
   backend::team_base(std::move(base)),
@@ -69,19 +271,19 @@ team team::split(intrank_t color, intrank_t key) const {
     GEX_FLAG_TM_SCRATCH_SIZE_RECOMMENDED
   );
   
-  void *scratch_buf = p_sub_tm
-    ? upcxx::allocate(scratch_sz, GASNET_PAGESIZE)
-    : nullptr;
+  scratch_buf scratch = p_sub_tm
+    ? scratch_acquire(scratch_sz)
+    : scratch_buf{nullptr, 0};
   
   gex_TM_Split(
     p_sub_tm, gasnet::handle_of(*this),
     color, key,
-    scratch_buf, scratch_sz,
+    scratch.buf, scratch.size,
     /*flags*/0
   );
   
   if(p_sub_tm)
-    gex_TM_SetCData(sub_tm, scratch_buf);
+    gex_TM_SetCData(sub_tm, scratch.buf);
   
   return team(
       detail::internal_only(),
@@ -92,6 +294,104 @@ team team::split(intrank_t color, intrank_t key) const {
     );
 }
 
+future<team> team::split_async(intrank_t color, intrank_t key) const {
+  UPCXX_ASSERT_INIT();
+  UPCXX_ASSERT_MASTER();
+  UPCXX_ASSERT_COLLECTIVE_SAFE(entry_barrier::user);
+  UPCXX_ASSERT(color >= 0 || color == color_none);
+
+  struct split_op final: construct_op {
+    intrank_t color, key;
+    
+    split_op(digest id, intrank_t color, intrank_t key):
+      construct_op(id), color(color), key(key) {
+    }
+    
+    gex_TM_t construct(gex_TM_t dup_tm) override {
+      gex_TM_t sub_tm = GEX_TM_INVALID;
+      gex_TM_t *p_sub_tm = color == color_none ? nullptr : &sub_tm;
+      
+      size_t scratch_sz = gex_TM_Split(
+        p_sub_tm, dup_tm, color, key, nullptr, 0,
+        GEX_FLAG_TM_SCRATCH_SIZE_RECOMMENDED
+      );
+      scratch_buf scratch = p_sub_tm
+        ? scratch_acquire(scratch_sz)
+        : scratch_buf{nullptr, 0};
+
+      gex_TM_Split(p_sub_tm, dup_tm, color, key, scratch.buf, scratch.size, /*flags*/0);
+      
+      if(p_sub_tm)
+        gex_TM_SetCData(sub_tm, scratch.buf);
+      return sub_tm;
+    }
+  };
+  
+  return construct_enqueue(*this, new split_op(
+    const_cast<team*>(this)->next_collective_id(detail::internal_only()).eat(color),
+    color, key
+  ));
+}
+
+future<team> team::create(std::vector<intrank_t> const &members) const {
+  UPCXX_ASSERT_INIT();
+  UPCXX_ASSERT_MASTER();
+  UPCXX_ASSERT_COLLECTIVE_SAFE(entry_barrier::user);
+  #if UPCXX_ASSERT_ENABLED
+  {
+    int me_n = 0;
+    for(intrank_t r: members) {
+      UPCXX_ASSERT(r >= 0 && r < this->rank_n(),
+        "team::create(members) requires members in [0, rank_n()-1] == [0, " << this->rank_n()-1 << "], but given: " << r);
+      me_n += r == this->rank_me() ? 1 : 0;
+    }
+    UPCXX_ASSERT(members.empty() || me_n == 1,
+      "team::create(members) requires the caller to appear exactly once in a non-empty members list.");
+  }
+  #endif
+
+  struct create_op final: construct_op {
+    std::vector<gex_EP_Location_t> locs;
+
+    create_op(digest id, std::vector<intrank_t> const &members):
+      construct_op(id), locs(members.size()) {
+      for(size_t i=0; i != members.size(); i++) {
+        locs[i].gex_rank = members[i];
+        locs[i].gex_ep_index = 0;
+      }
+    }
+
+    gex_TM_t construct(gex_TM_t dup_tm) override {
+      if(locs.empty()) {
+        gex_TM_Create(nullptr, 0, dup_tm, nullptr, 0, nullptr, 0, /*flags*/0);
+        return GEX_TM_INVALID;
+      }
+      
+      size_t scratch_sz = gex_TM_Create(
+        nullptr, 1, dup_tm, locs.data(), locs.size(), nullptr, 0,
+        GEX_FLAG_TM_SCRATCH_SIZE_RECOMMENDED
+      );
+      scratch_buf scratch = scratch_acquire(scratch_sz);
+      
+      gex_TM_t sub_tm = GEX_TM_INVALID;
+      gex_TM_Create(
+        &sub_tm, 1, dup_tm, locs.data(), locs.size(),
+        &scratch.buf, scratch.size, /*flags*/0
+      );
+      gex_TM_SetCData(sub_tm, scratch.buf);
+      return sub_tm;
+    }
+  };
+
+  // Members all name the same first rank, and disjoint teams name different
+  // ones, which makes for a team-unique id.
+  return construct_enqueue(*this, new create_op(
+    const_cast<team*>(this)->next_collective_id(detail::internal_only())
+      .eat(members.empty() ? color_none : members[0]),
+    members
+  ));
+}
+
 void team::destroy(entry_barrier eb) {
   UPCXX_ASSERT_INIT();
   UPCXX_ASSERT_MASTER();
@@ -110,6 +410,8 @@ void team::destroy(detail::internal_only, entry_barrier eb) {
   if(tm != GEX_TM_INVALID) {
     backend::quiesce(*this, eb);
 
+    construct_state_destroy(*this);
+
     void *scratch = gex_TM_QueryCData(tm);
 
     if (tm != gasnet::handle_of(detail::the_world_team.value())) {
@@ -119,9 +421,23 @@ void team::destroy(detail::internal_only, entry_barrier eb) {
         if (scratch) UPCXX_ASSERT(scratch == scratch_area.gex_addr);
     }
     
-    upcxx::deallocate(scratch);
+    if(!scratch_release(scratch))
+      upcxx::deallocate(scratch);
   }
   
   if(id_ != digest{~0ull, ~0ull})
     detail::registry.erase(id_);
 }
+
+void detail::teams_finalize() {
+  // The world team is never destroyed (nor are leaked teams), so neither are
+  // their duplicate TMs, but the bookkeeping must not outlive this init epoch.
+  for(auto &id_st: construct_states)
+    delete id_st.second;
+  construct_states.clear();
+  
+  for(scratch_buf sb: scratch_pool)
+    gasnet::deallocate(sb.buf, &gasnet::sheap_footprint_misc);
+  scratch_pool.clear();
+  scratch_live.clear();
+}
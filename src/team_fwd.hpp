@@ -6,7 +6,9 @@
 #include <upcxx/digest.hpp>
 #include <upcxx/utility.hpp>
 
+#include <cstddef>
 #include <unordered_map>
+#include <vector>
 
 /* This is the forward declaration(s) of upcxx::team and friends. It does not
  * define the function bodies nor does it pull in the full backend header.
@@ -17,6 +19,23 @@
 namespace upcxx {
   namespace detail {
     extern std::unordered_map<digest, void*> registry;
+
+    // Direct-mapped table in front of `registry` for live dist_object
+    // promises, letting incoming RPCs find their target without hashing
+    // into the map. The slot number comes from the id's digest, which is
+    // uniformly distributed and identical on every rank, so it travels on
+    // the wire for free. Colliding ids just stay map-only.
+    struct dist_slot {
+      digest id;
+      void *promise; // future_header_promise<dist_object<T>&>*, or null
+    };
+    
+    constexpr std::size_t dist_slot_n = 1024; // power of 2
+    extern dist_slot dist_slots[dist_slot_n];
+    
+    inline dist_slot& dist_slot_of(digest id) {
+      return dist_slots[id.w0 & (dist_slot_n-1)];
+    }
     
     // Get the promise pointer from the master map.
     template<typename T>
@@ -24,6 +43,10 @@ namespace upcxx {
 
     template<typename T, typename ...U>
     T* registered_state(digest id, U &&...ctor_args);
+
+    // Drops pooled team scratch and other team construction state, called
+    // during finalize.
+    void teams_finalize();
   }
   
   class team;
@@ -123,6 +146,22 @@ namespace upcxx {
     static constexpr intrank_t color_none = -0xbad;
     
     team split(intrank_t color, intrank_t key) const;
+
+    // Deferred team construction. Both are collective over this team and
+    // must be issued in the same order as its other collectives. The first
+    // call against a team blocks once, collectively, to duplicate it; later
+    // calls return immediately. Deferred constructions against all teams then
+    // run one at a time in issue order: each waits in a non-blocking barrier
+    // until every member has issued it, and then user-level progress() blocks
+    // in GASNet's team constructor until the new team exists. What overlaps
+    // with computation is the wait for late members, not the construction.
+    // `create`
+    // takes the ranks (relative to this team) of the new team the caller
+    // joins, identical across its members, or an empty vector to join none.
+    // The result is moved out with `std::move(fut).wait()`, which requires
+    // that no copies of the future remain.
+    future<team> split_async(intrank_t color, intrank_t key) const;
+    future<team> create(std::vector<intrank_t> const &members) const;
     
     void destroy(entry_barrier eb = entry_barrier::user);
     
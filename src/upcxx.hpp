@@ -7,17 +7,24 @@
 #include <upcxx/backend.hpp>
 #include <upcxx/barrier.hpp>
 #include <upcxx/broadcast.hpp>
+#include <upcxx/comm_plan.hpp>
 #include <upcxx/copy.hpp>
 #include <upcxx/cuda.hpp>
+#include <upcxx/dist_array.hpp>
 #include <upcxx/dist_object.hpp>
+#include <upcxx/dist_unordered_map.hpp>
 #include <upcxx/future.hpp>
 #include <upcxx/global_ptr.hpp>
+#include <upcxx/nbi.hpp>
+#include <upcxx/notify_counter.hpp>
 #include <upcxx/os_env.hpp>
 #include <upcxx/persona.hpp>
 #include <upcxx/reduce.hpp>
 #include <upcxx/rget.hpp>
+#include <upcxx/rma_chunked.hpp>
 #include <upcxx/rput.hpp>
 #include <upcxx/rpc.hpp>
+#include <upcxx/task_pool.hpp>
 #include <upcxx/team.hpp>
 #include <upcxx/vis.hpp>
 //#include <upcxx/wait.hpp>
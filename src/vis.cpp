@@ -5,6 +5,7 @@
 #endif
 
 #include <cstddef>
+#include <cstring>
 
 namespace gasnet = upcxx::backend::gasnet;
 
@@ -40,11 +41,11 @@ void upcxx::detail::rma_put_irreg_nb(
     {
       gex_Event_t VISput_LC = gex_Event_QueryLeaf(op_h, GEX_EC_LC);
       source_cb->handle = reinterpret_cast<uintptr_t>(VISput_LC);
-      gasnet::register_cb(source_cb);// it appears to matter in what order I register_cb
+      gasnet::register_cb(source_cb, gasnet::handle_cb_class::rma_put);// it appears to matter in what order I register_cb
     }
   else
     {
-      gasnet::register_cb(operation_cb);
+      gasnet::register_cb(operation_cb, gasnet::handle_cb_class::rma_put);
     }
   gasnet::after_gasnet();
 }
@@ -69,7 +70,7 @@ void upcxx::detail::rma_get_irreg_nb(
                                          /* flags */ 0);
 
   operation_cb->handle = reinterpret_cast<uintptr_t>(op_h);
-  gasnet::register_cb(operation_cb);
+  gasnet::register_cb(operation_cb, gasnet::handle_cb_class::rma_get);
   gasnet::after_gasnet();
 }
 
@@ -97,11 +98,11 @@ void upcxx::detail::rma_put_reg_nb(
     {
       gex_Event_t VISput_LC = gex_Event_QueryLeaf(op_h, GEX_EC_LC);
       source_cb->handle = reinterpret_cast<uintptr_t>(VISput_LC);
-      gasnet::register_cb(source_cb);// it appears to matter in what order I register_cb
+      gasnet::register_cb(source_cb, gasnet::handle_cb_class::rma_put);// it appears to matter in what order I register_cb
     }
   else
     {
-      gasnet::register_cb(operation_cb);
+      gasnet::register_cb(operation_cb, gasnet::handle_cb_class::rma_put);
     }
   gasnet::after_gasnet();
 }
@@ -122,7 +123,7 @@ void upcxx::detail::rma_get_reg_nb(
                               /*flags*/ 0);
   
   operation_cb->handle = reinterpret_cast<uintptr_t>(op_h);
-  gasnet::register_cb(operation_cb);
+  gasnet::register_cb(operation_cb, gasnet::handle_cb_class::rma_get);
   gasnet::after_gasnet();
 }
 
@@ -152,11 +153,11 @@ void upcxx::detail::rma_put_strided_nb(
     {
       gex_Event_t VISput_LC = gex_Event_QueryLeaf(op_h, GEX_EC_LC);
       source_cb->handle = reinterpret_cast<uintptr_t>(VISput_LC);
-      gasnet::register_cb(source_cb);// it appears to matter in what order I register_cb
+      gasnet::register_cb(source_cb, gasnet::handle_cb_class::rma_put);// it appears to matter in what order I register_cb
     }
   else
     {
-      gasnet::register_cb(operation_cb);
+      gasnet::register_cb(operation_cb, gasnet::handle_cb_class::rma_put);
     }
   gasnet::after_gasnet();
 
@@ -181,8 +182,99 @@ void upcxx::detail::rma_get_strided_nb(
  
 
   operation_cb->handle = reinterpret_cast<uintptr_t>(op_h);
-  gasnet::register_cb(operation_cb);
+  gasnet::register_cb(operation_cb, gasnet::handle_cb_class::rma_get);
   gasnet::after_gasnet();
 
 }
 
+
+namespace {
+  // Innermost level: `n` elements of `Word` size. Word-typed loads and
+  // stores let the compiler vectorize the common unit-stride cases.
+  template<typename Word>
+  void strided_copy_words(char *d, std::ptrdiff_t ds,
+                          char const *s, std::ptrdiff_t ss, std::size_t n) {
+    for(std::size_t i=0; i < n; i++) {
+      Word w;
+      std::memcpy(&w, s + std::ptrdiff_t(i)*ss, sizeof(Word));
+      std::memcpy(d + std::ptrdiff_t(i)*ds, &w, sizeof(Word));
+    }
+  }
+
+  void strided_copy_level(char *d, const std::ptrdiff_t ds[],
+                          char const *s, const std::ptrdiff_t ss[],
+                          std::size_t elemsz, const std::size_t count[],
+                          std::size_t level) {
+    if(level == 0) {
+      std::size_t n = count[0];
+      if(ds[0] == std::ptrdiff_t(elemsz) && ss[0] == std::ptrdiff_t(elemsz))
+        upcxx::backend::local_copy(d, s, n*elemsz);
+      else switch(elemsz) {
+        case 4: strided_copy_words<std::uint32_t>(d, ds[0], s, ss[0], n); break;
+        case 8: strided_copy_words<std::uint64_t>(d, ds[0], s, ss[0], n); break;
+        default:
+          for(std::size_t i=0; i < n; i++)
+            std::memcpy(d + std::ptrdiff_t(i)*ds[0], s + std::ptrdiff_t(i)*ss[0], elemsz);
+      }
+    }
+    else {
+      for(std::size_t i=0; i < count[level]; i++)
+        strided_copy_level(d + std::ptrdiff_t(i)*ds[level], ds,
+                           s + std::ptrdiff_t(i)*ss[level], ss,
+                           elemsz, count, level-1);
+    }
+  }
+}
+
+void upcxx::detail::rma_strided_copy_local(
+                        void *_dstaddr, const std::ptrdiff_t _dststrides[],
+                        const void *_srcaddr, const std::ptrdiff_t _srcstrides[],
+                        std::size_t _elemsz,
+                        const std::size_t _count[], std::size_t _stridelevels) {
+  char *d = static_cast<char*>(_dstaddr);
+  char const *s = static_cast<char const*>(_srcaddr);
+
+  if(_stridelevels == 0)
+    upcxx::backend::local_copy(d, s, _elemsz);
+  else
+    strided_copy_level(d, _dststrides, s, _srcstrides,
+                       _elemsz, _count, _stridelevels-1);
+}
+
+std::size_t upcxx::detail::rma_strided_coalesce(
+                        std::ptrdiff_t _dststrides[],
+                        std::ptrdiff_t _srcstrides[],
+                        std::size_t &_elemsz,
+                        std::size_t _count[], std::size_t _stridelevels) {
+  // An empty transfer keeps its shape, there is nothing to gain.
+  for(std::size_t i=0; i < _stridelevels; i++) {
+    if(_count[i] == 0)
+      return _stridelevels;
+  }
+
+  std::size_t n = 0;
+  for(std::size_t i=0; i < _stridelevels; i++) {
+    if(_count[i] == 1)
+      continue; // stride is irrelevant
+
+    if(n == 0 &&
+       _dststrides[i] == std::ptrdiff_t(_elemsz) &&
+       _srcstrides[i] == std::ptrdiff_t(_elemsz)) {
+      _elemsz *= _count[i]; // contiguous on both sides
+      continue;
+    }
+
+    if(n != 0 &&
+       _dststrides[i] == _dststrides[n-1]*std::ptrdiff_t(_count[n-1]) &&
+       _srcstrides[i] == _srcstrides[n-1]*std::ptrdiff_t(_count[n-1])) {
+      _count[n-1] *= _count[i]; // continues the previous level
+      continue;
+    }
+
+    _dststrides[n] = _dststrides[i];
+    _srcstrides[n] = _srcstrides[i];
+    _count[n] = _count[i];
+    n += 1;
+  }
+  return n;
+}
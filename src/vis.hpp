@@ -5,6 +5,7 @@
 #include <upcxx/global_ptr.hpp>
 #include <upcxx/rput.hpp>
 #include <upcxx/rget.hpp>
+#include <array>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -229,6 +230,24 @@ namespace upcxx
                             std::size_t _elemsz,
                             const std::size_t _count[], std::size_t _stridelevels,
                             backend::gasnet::handle_cb *operation_cb);
+
+    // Strided copy between two addresses of this process, same argument
+    // conventions as the gasnet strided calls.
+    void rma_strided_copy_local(
+                            void *_dstaddr, const std::ptrdiff_t _dststrides[],
+                            const void *_srcaddr, const std::ptrdiff_t _srcstrides[],
+                            std::size_t _elemsz,
+                            const std::size_t _count[], std::size_t _stridelevels);
+
+    // Rewrite a strided descriptor in place into the fewest levels that
+    // describe the same transfer: unit extents are dropped, dimensions
+    // contiguous on both sides fold into `_elemsz`, and neighbors whose strides
+    // chain are merged. Returns the new number of levels.
+    std::size_t rma_strided_coalesce(
+                            std::ptrdiff_t _dststrides[],
+                            std::ptrdiff_t _srcstrides[],
+                            std::size_t &_elemsz,
+                            std::size_t _count[], std::size_t _stridelevels);
     
 
     template<typename CxStateHere, typename CxStateRemote>
@@ -309,6 +328,7 @@ namespace upcxx
         state_remote(std::move(remote))
       {
       }
+      UPCXX_OPNEW_POOLED(rput_cbs_strided)
       static constexpr bool static_scope = false;
       void initiate(intrank_t rd,
                     void* dst_addr, const std::ptrdiff_t* dststrides,
@@ -377,6 +397,7 @@ namespace upcxx
       rget_cbs_strided(intrank_t rank_s, CxStateHere here, CxStateRemote remote)
         : rget_cb_remote<CxStateRemote>{rank_s, std::move(remote)},
         state_here{std::move(here)} { }
+      UPCXX_OPNEW_POOLED(rget_cbs_strided)
       void initiate(
                     void* dst_addr, const std::ptrdiff_t* dststrides,
                     intrank_t rank_s,
@@ -805,6 +826,126 @@ namespace upcxx
   }
 
   
+  namespace detail {
+    ////////////////////////////////////////////////////////////////////////////
+    // rput_strided_levels / rget_strided_levels: The byte-level bodies of
+    // rput_strided and rget_strided, taking the element size and number of
+    // stride levels at runtime so that strided_plan (below) can hand over an
+    // already coalesced descriptor. Memory of a peer in our local_team is
+    // copied in place, unless remote completion was asked for.
+
+    template<typename Cxs>
+    typename completions_returner<
+      /*EventPredicate=*/event_is_here,
+      /*EventValues=*/rput_event_values,
+      typename std::decay<Cxs>::type>::return_t
+    rput_strided_levels(
+        void const *src_addr, std::ptrdiff_t const *src_strides,
+        intrank_t rank_d, void *dest_addr, std::ptrdiff_t const *dest_strides,
+        std::size_t elemsz, std::size_t const *count, std::size_t levels,
+        Cxs &&cxs) {
+
+      using CxsDecayed = typename std::decay<Cxs>::type;
+
+      if(!completions_has_event<CxsDecayed, remote_cx_event>::value &&
+         backend::rank_is_local(rank_d)) {
+        void *dest_local = backend::localize_memory_nonnull(
+          rank_d, reinterpret_cast<std::uintptr_t>(dest_addr)
+        );
+        return detail::template rma_put_local<rput_event_values>(
+          [=]() {
+            rma_strided_copy_local(dest_local, dest_strides, src_addr, src_strides,
+                                   elemsz, count, levels);
+          },
+          std::forward<Cxs>(cxs)
+        );
+      }
+
+      using cxs_here_t = completions_state<
+        /*EventPredicate=*/event_is_here,
+        /*EventValues=*/rput_event_values,
+        CxsDecayed>;
+      using cxs_remote_t = completions_state<
+        /*EventPredicate=*/event_is_remote,
+        /*EventValues=*/rput_event_values,
+        CxsDecayed>;
+
+      rput_cbs_strided<cxs_here_t, cxs_remote_t> cbs_static{
+        rank_d,
+        cxs_here_t{std::forward<Cxs>(cxs)},
+        cxs_remote_t{std::forward<Cxs>(cxs)}
+      };
+      auto *cbs = decltype(cbs_static)::static_scope
+        ? &cbs_static
+        : new decltype(cbs_static){std::move(cbs_static)};
+
+      auto returner = completions_returner<
+          /*EventPredicate=*/event_is_here,
+          /*EventValues=*/rput_event_values,
+          CxsDecayed
+        >{cbs->state_here};
+
+      cbs->initiate(rank_d, dest_addr, dest_strides,
+                    src_addr, src_strides, elemsz, count, levels);
+
+      return returner();
+    }
+
+    template<typename Cxs>
+    typename completions_returner<
+      /*EventPredicate=*/event_is_here,
+      /*EventValues=*/rput_event_values,
+      typename std::decay<Cxs>::type>::return_t
+    rget_strided_levels(
+        intrank_t rank_s, void const *src_addr, std::ptrdiff_t const *src_strides,
+        void *dest_addr, std::ptrdiff_t const *dest_strides,
+        std::size_t elemsz, std::size_t const *count, std::size_t levels,
+        Cxs &&cxs) {
+
+      using CxsDecayed = typename std::decay<Cxs>::type;
+
+      if(!completions_has_event<CxsDecayed, remote_cx_event>::value &&
+         backend::rank_is_local(rank_s)) {
+        void const *src_local = backend::localize_memory_nonnull(
+          rank_s, reinterpret_cast<std::uintptr_t>(src_addr)
+        );
+        return detail::template rma_put_local<rput_event_values>(
+          [=]() {
+            rma_strided_copy_local(dest_addr, dest_strides, src_local, src_strides,
+                                   elemsz, count, levels);
+          },
+          std::forward<Cxs>(cxs)
+        );
+      }
+
+      using cxs_here_t = completions_state<
+        /*EventPredicate=*/event_is_here,
+        /*EventValues=*/rput_event_values,
+        CxsDecayed>;
+      using cxs_remote_t = completions_state<
+        /*EventPredicate=*/event_is_remote,
+        /*EventValues=*/rput_event_values,
+        CxsDecayed>;
+
+      auto *cbs = new rget_cbs_strided<cxs_here_t, cxs_remote_t>{
+        rank_s,
+        cxs_here_t{std::forward<Cxs>(cxs)},
+        cxs_remote_t{std::forward<Cxs>(cxs)}
+      };
+
+      auto returner = completions_returner<
+        /*EventPredicate=*/event_is_here,
+        /*EventValues=*/rput_event_values,
+        CxsDecayed
+        >{cbs->state_here};
+
+      cbs->initiate(dest_addr, dest_strides,
+                    rank_s, src_addr, src_strides, elemsz, count, levels);
+
+      return returner();
+    }
+  }
+
   template<std::size_t Dim, typename T,
            typename Cxs=decltype(operation_cx::as_future())>
   UPCXX_NODISCARD
@@ -838,34 +979,12 @@ namespace upcxx
     UPCXX_GPTR_CHK(dest_base);
     UPCXX_ASSERT(src_base && dest_base, "pointer arguments to rput_strided may not be null");
 
-    using cxs_here_t = detail::completions_state<
-      /*EventPredicate=*/detail::event_is_here,
-      /*EventValues=*/detail::rput_event_values,
-      CxsDecayed>;
-    using cxs_remote_t = detail::completions_state<
-      /*EventPredicate=*/detail::event_is_remote,
-      /*EventValues=*/detail::rput_event_values,
-      CxsDecayed>;
-
-    detail::rput_cbs_strided<cxs_here_t, cxs_remote_t> cbs_static{
-      dest_base.rank_,
-      cxs_here_t{std::forward<Cxs>(cxs)},
-      cxs_remote_t{std::forward<Cxs>(cxs)}
-    };
-        auto *cbs = decltype(cbs_static)::static_scope
-      ? &cbs_static
-      : new decltype(cbs_static){std::move(cbs_static)};
-    
-    auto returner = detail::completions_returner<
-        /*EventPredicate=*/detail::event_is_here,
-        /*EventValues=*/detail::rput_event_values,
-        CxsDecayed
-      >{cbs->state_here};
-    
-    cbs->initiate(dest_base.rank_, dest_base.raw_ptr_, dest_strides,
-                  src_base, src_strides, sizeof(T), extents, Dim);
-    
-    return returner();
+    return detail::rput_strided_levels(
+      src_base, src_strides,
+      dest_base.rank_, dest_base.raw_ptr_, dest_strides,
+      sizeof(T), extents, Dim,
+      std::forward<Cxs>(cxs)
+    );
   }
 
   template<std::size_t Dim, typename T,
@@ -922,31 +1041,12 @@ namespace upcxx
     UPCXX_GPTR_CHK(src_base);
     UPCXX_ASSERT(src_base && dest_base, "pointer arguments to rget_strided may not be null");
 
-    using cxs_here_t = detail::completions_state<
-      /*EventPredicate=*/detail::event_is_here,
-      /*EventValues=*/detail::rput_event_values,
-      CxsDecayed>;
-    using cxs_remote_t = detail::completions_state<
-      /*EventPredicate=*/detail::event_is_remote,
-      /*EventValues=*/detail::rput_event_values,
-      CxsDecayed>;
-
-    auto *cbs = new detail::rget_cbs_strided<cxs_here_t, cxs_remote_t>{
-      src_base.rank_,
-      cxs_here_t{std::forward<Cxs>(cxs)},
-      cxs_remote_t{std::forward<Cxs>(cxs)}
-    };
-    
-    auto returner = detail::completions_returner<
-      /*EventPredicate=*/detail::event_is_here,
-      /*EventValues=*/detail::rput_event_values,
-      CxsDecayed
-      >{cbs->state_here};
-    
-    cbs->initiate(dest_base, dest_strides,
-                  src_base.rank_, src_base.raw_ptr_, src_strides, sizeof(T), extents, Dim);
-    
-    return returner();
+    return detail::rget_strided_levels(
+      src_base.rank_, src_base.raw_ptr_, src_strides,
+      dest_base, dest_strides,
+      sizeof(T), extents, Dim,
+      std::forward<Cxs>(cxs)
+    );
   }
   
 
@@ -970,7 +1070,131 @@ namespace upcxx
                               dest_base, &dest_strides.front(),
                               &extents.front(), std::forward<Cxs>(cxs));
   }
- 
+
+  /////////////////////////////////////////////////////////////////////
+  // strided_plan: A strided transfer shape that is validated and reduced
+  // once, then replayed against any pair of base addresses. Construction
+  // folds contiguous dimensions into larger elements and merges dimensions
+  // whose strides chain, so each rput/rget hands gasnet (or the in-place
+  // copy used for local_team() peers) the shortest descriptor possible,
+  // and nothing is allocated beyond the pooled completion callback.
+  // Strides are in bytes and dimension 0 varies fastest, as for rput_strided.
+
+  class comm_plan;
+
+  template<typename T, std::size_t Dim>
+  class strided_plan {
+    friend class comm_plan;
+
+    static_assert(is_trivially_serializable<T>::value,
+      "RMA operations only work on TriviallySerializable types.");
+
+    std::ptrdiff_t src_strides_[Dim == 0 ? 1 : Dim];
+    std::ptrdiff_t dest_strides_[Dim == 0 ? 1 : Dim];
+    std::size_t count_[Dim == 0 ? 1 : Dim];
+    std::size_t levels_, elemsz_;
+    std::size_t size_;
+    std::ptrdiff_t src_offset_ = 0, dest_offset_ = 0;
+
+  public:
+    strided_plan(std::array<std::ptrdiff_t,Dim> const &src_strides,
+                 std::array<std::ptrdiff_t,Dim> const &dest_strides,
+                 std::array<std::size_t,Dim> const &extents) {
+      size_ = 1;
+      for(std::size_t d=0; d < Dim; d++) {
+        src_strides_[d] = src_strides[d];
+        dest_strides_[d] = dest_strides[d];
+        count_[d] = extents[d];
+        size_ *= extents[d];
+      }
+      elemsz_ = sizeof(T);
+      levels_ = detail::rma_strided_coalesce(dest_strides_, src_strides_,
+                                             elemsz_, count_, Dim);
+    }
+
+    // Copies the box `extents` at `src_lo` of a dense `src_dims` array to
+    // `dest_lo` of a dense `dest_dims` array. The base addresses later passed
+    // to rput/rget are those of the whole arrays.
+    static strided_plan dense_slices(std::array<std::size_t,Dim> const &src_dims,
+                                     std::array<std::size_t,Dim> const &src_lo,
+                                     std::array<std::size_t,Dim> const &dest_dims,
+                                     std::array<std::size_t,Dim> const &dest_lo,
+                                     std::array<std::size_t,Dim> const &extents) {
+      std::array<std::ptrdiff_t,Dim> src_strides, dest_strides;
+      std::ptrdiff_t src_offset = 0, dest_offset = 0;
+      std::ptrdiff_t src_stride = sizeof(T), dest_stride = sizeof(T);
+
+      for(std::size_t d=0; d < Dim; d++) {
+        UPCXX_ASSERT(src_lo[d] + extents[d] <= src_dims[d] &&
+                     dest_lo[d] + extents[d] <= dest_dims[d],
+                     "strided_plan::dense_slices: slice exceeds its array in dimension "<<d);
+        src_strides[d] = src_stride;
+        dest_strides[d] = dest_stride;
+        src_offset += std::ptrdiff_t(src_lo[d])*src_stride;
+        dest_offset += std::ptrdiff_t(dest_lo[d])*dest_stride;
+        src_stride *= src_dims[d];
+        dest_stride *= dest_dims[d];
+      }
+
+      strided_plan ans(src_strides, dest_strides, extents);
+      ans.src_offset_ = src_offset;
+      ans.dest_offset_ = dest_offset;
+      return ans;
+    }
+
+    // Number of elements moved per transfer.
+    std::size_t size() const { return size_; }
+
+    // Stride levels left after coalescing, 0 means one contiguous run.
+    std::size_t levels() const { return levels_; }
+
+    template<typename Cxs=decltype(operation_cx::as_future())>
+    UPCXX_NODISCARD
+    typename detail::completions_returner<
+      /*EventPredicate=*/detail::event_is_here,
+      /*EventValues=*/detail::rput_event_values,
+      typename std::decay<Cxs>::type>::return_t
+    rput(T const *src_base, global_ptr<T> dest_base,
+         Cxs &&cxs=completions<future_cx<operation_cx_event>>{{}}) const {
+      UPCXX_ASSERT_INIT();
+      UPCXX_GPTR_CHK(dest_base);
+      UPCXX_ASSERT(src_base && dest_base, "pointer arguments to strided_plan::rput may not be null");
+
+      return detail::rput_strided_levels(
+        reinterpret_cast<char const*>(src_base) + src_offset_, src_strides_,
+        dest_base.rank_, reinterpret_cast<char*>(dest_base.raw_ptr_) + dest_offset_, dest_strides_,
+        elemsz_, count_, levels_,
+        std::forward<Cxs>(cxs)
+      );
+    }
+
+    // Note the source and destination roles: `src_strides`/`src_dims` of the
+    // plan describe `src_base`, which here is the remote side.
+    template<typename Cxs=decltype(operation_cx::as_future())>
+    UPCXX_NODISCARD
+    typename detail::completions_returner<
+      /*EventPredicate=*/detail::event_is_here,
+      /*EventValues=*/detail::rput_event_values,
+      typename std::decay<Cxs>::type>::return_t
+    rget(global_ptr<const T> src_base, T *dest_base,
+         Cxs &&cxs=completions<future_cx<operation_cx_event>>{{}}) const {
+      using CxsDecayed = typename std::decay<Cxs>::type;
+      UPCXX_ASSERT_INIT();
+      UPCXX_ASSERT_ALWAYS(
+        (!detail::completions_has_event<CxsDecayed, source_cx_event>::value),
+        "strided_plan::rget does not support source completion."
+      );
+      UPCXX_GPTR_CHK(src_base);
+      UPCXX_ASSERT(src_base && dest_base, "pointer arguments to strided_plan::rget may not be null");
+
+      return detail::rget_strided_levels(
+        src_base.rank_, reinterpret_cast<char const*>(src_base.raw_ptr_) + src_offset_, src_strides_,
+        reinterpret_cast<char*>(dest_base) + dest_offset_, dest_strides_,
+        elemsz_, count_, levels_,
+        std::forward<Cxs>(cxs)
+      );
+    }
+  };
 }
 
 
@@ -0,0 +1,96 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <sched.h>
+
+#if !UPCXX_THREADMODE
+  #error This test may only be compiled in PAR threadmode
+#endif
+
+// Concurrent small shared-heap allocations from many threads, with half of
+// the objects freed by a thread other than the one which allocated them.
+
+using namespace std;
+
+template<typename Fn>
+void run_threads(int tn, Fn &&fn) {
+  std::vector<std::thread*> ts;
+  ts.resize(tn);
+
+  for(int ti=1; ti < tn; ti++)
+    ts[ti] = new std::thread(fn, ti);
+  fn(0);
+
+  for(int ti=1; ti < tn; ti++) {
+    ts[ti]->join();
+    delete ts[ti];
+  }
+}
+
+const int per_thread = 5000;
+
+void one_round(int tn) {
+  // objects allocated by thread ti which thread (ti+1)%tn will free
+  vector<vector<void*>> handoff(tn);
+  std::atomic<int> arrived(0);
+
+  run_threads(tn, [&](int ti) {
+    vector<void*> mine;
+
+    for(int i=0; i < per_thread; i++) {
+      size_t align = size_t(1) << (i % 8);
+      size_t size = 1 + (i*37) % 2500;
+      void *p = upcxx::allocate(size, align);
+      UPCXX_ASSERT_ALWAYS(p != nullptr);
+      UPCXX_ASSERT_ALWAYS(reinterpret_cast<uintptr_t>(p) % align == 0);
+      std::memset(p, ti, size);
+
+      if(i % 2) mine.push_back(p);
+      else handoff[ti].push_back(p);
+    }
+
+    for(void *p: mine)
+      upcxx::deallocate(p);
+
+    arrived += 1;
+    while(arrived.load() != tn)
+      sched_yield();
+
+    for(void *p: handoff[(ti + tn-1) % tn]) {
+      UPCXX_ASSERT_ALWAYS(*static_cast<char*>(p) == char((ti + tn-1) % tn));
+      upcxx::deallocate(p);
+    }
+  });
+}
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  int tn = upcxx::os_env<int>("THREADS", 8);
+  if(upcxx::rank_me() == 0)
+    std::cout<<"Threads: "<<tn<<'\n';
+
+  int64_t used0 = upcxx::shared_segment_used();
+
+  one_round(tn);
+  int64_t used1 = upcxx::shared_segment_used();
+  UPCXX_ASSERT_ALWAYS(used1 >= used0);
+
+  // an identical round must be satisfied entirely from memory freed by the first
+  one_round(tn);
+  int64_t used2 = upcxx::shared_segment_used();
+  UPCXX_ASSERT_ALWAYS(used2 == used1, "used after round 1 = "<<used1<<", after round 2 = "<<used2);
+
+  upcxx::barrier();
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
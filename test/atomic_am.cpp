@@ -0,0 +1,94 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <cstdint>
+
+// atomic_domain over types GASNet has no atomics for: a 16-byte
+// (pointer, tag) pair updated by compare_exchange from every rank, as a
+// lock-free stack head would be, and a small struct with load/store.
+
+using namespace std;
+using upcxx::atomic_op;
+using upcxx::global_ptr;
+
+struct tagged_ptr {
+  std::uintptr_t ptr;
+  std::uint64_t tag;
+};
+
+struct triple {
+  std::int32_t a, b, c;
+};
+
+constexpr int ITERS = 50;
+
+static_assert(upcxx::detail::atomic_via_am<tagged_ptr>::value, "");
+static_assert(!upcxx::detail::atomic_via_am<std::uint64_t>::value, "");
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  int me = upcxx::rank_me();
+  int n = upcxx::rank_n();
+
+  {
+    upcxx::atomic_domain<tagged_ptr> ad({atomic_op::load, atomic_op::store,
+                                         atomic_op::compare_exchange});
+
+    upcxx::dist_object<global_ptr<tagged_ptr>> dobj(upcxx::new_<tagged_ptr>(tagged_ptr{0, 0}));
+    global_ptr<tagged_ptr> head = dobj.fetch(0).wait();
+
+    // each successful CAS bumps the tag and records the winner in ptr
+    int wins = 0;
+    while(wins < ITERS) {
+      tagged_ptr cur = ad.load(head, memory_order_acquire).wait();
+      tagged_ptr want{std::uintptr_t(me), cur.tag + 1};
+      tagged_ptr prior = ad.compare_exchange(head, cur, want, memory_order_acq_rel).wait();
+      UPCXX_ASSERT_ALWAYS(prior.tag >= cur.tag);
+      if(prior.tag == cur.tag && prior.ptr == cur.ptr)
+        wins += 1;
+    }
+
+    upcxx::barrier();
+    tagged_ptr fin = ad.load(head, memory_order_relaxed).wait();
+    UPCXX_ASSERT_ALWAYS(fin.tag == std::uint64_t(ITERS)*n, "tag=" << fin.tag);
+    UPCXX_ASSERT_ALWAYS(fin.ptr < std::uintptr_t(n));
+
+    // a failed compare_exchange leaves the value alone and reports it
+    upcxx::barrier();
+    tagged_ptr bogus{~std::uintptr_t(0), 0};
+    tagged_ptr prior = ad.compare_exchange(head, bogus, bogus, memory_order_relaxed).wait();
+    UPCXX_ASSERT_ALWAYS(prior.tag == fin.tag && prior.ptr == fin.ptr);
+
+    upcxx::barrier();
+    upcxx::delete_(*dobj);
+    ad.destroy();
+  }
+
+  {
+    upcxx::atomic_domain<triple> ad({atomic_op::load, atomic_op::store});
+
+    upcxx::dist_object<global_ptr<triple>> dobj(upcxx::new_<triple>(triple{0, 0, 0}));
+    global_ptr<triple> nebr = dobj.fetch((me + 1) % n).wait();
+
+    upcxx::promise<> p;
+    ad.store(nebr, triple{me, -me, 2*me}, memory_order_release,
+             upcxx::operation_cx::as_promise(p));
+    p.finalize().wait();
+
+    upcxx::barrier();
+    int from = (me + n - 1) % n;
+    triple got = ad.load(*dobj, memory_order_acquire).wait();
+    UPCXX_ASSERT_ALWAYS(got.a == from && got.b == -from && got.c == 2*from);
+
+    upcxx::barrier();
+    upcxx::delete_(*dobj);
+    ad.destroy();
+  }
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
@@ -0,0 +1,141 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+// A distributed histogram built with batched atomics: plain, combined, and
+// fetching batches, each checked against the counts every rank contributed.
+
+using namespace std;
+using upcxx::atomic_op;
+using upcxx::global_ptr;
+using upcxx::intrank_t;
+
+constexpr int BINS_PER_RANK = 16;
+constexpr int UPDATES = 4000;
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+  int bins = BINS_PER_RANK*n;
+
+  upcxx::atomic_domain<int64_t> ad({atomic_op::add, atomic_op::fetch_add,
+                                    atomic_op::max, atomic_op::load, atomic_op::store});
+
+  upcxx::dist_object<global_ptr<int64_t>> mine(upcxx::new_array<int64_t>(BINS_PER_RANK));
+  vector<global_ptr<int64_t>> bin(bins);
+  for(intrank_t r=0; r < n; r++) {
+    global_ptr<int64_t> base = mine.fetch(r).wait();
+    for(int b=0; b < BINS_PER_RANK; b++)
+      bin[r*BINS_PER_RANK + b] = base + b;
+  }
+
+  // bins are only ever accessed through the domain
+  vector<pair<global_ptr<int64_t>, int64_t>> my_bins;
+  for(int b=0; b < BINS_PER_RANK; b++)
+    my_bins.push_back({bin[me*BINS_PER_RANK + b], 0});
+
+  auto zero = [&]() {
+    ad.op_batch(atomic_op::store, my_bins.begin(), my_bins.end(), memory_order_relaxed).wait();
+    upcxx::barrier();
+  };
+
+  // every rank's updates are a function of its rank, so anyone can compute
+  // the expected totals
+  auto updates_of = [&](intrank_t r) {
+    mt19937_64 rng(1000 + r);
+    vector<pair<global_ptr<int64_t>, int64_t>> ups;
+    for(int i=0; i < UPDATES; i++) {
+      int b = int(rng() % bins);
+      ups.push_back({bin[b], int64_t(1 + rng() % 5)});
+    }
+    return ups;
+  };
+  vector<int64_t> expect(bins, 0), expect_max(bins, 0);
+  for(intrank_t r=0; r < n; r++) {
+    for(auto const &up: updates_of(r)) {
+      int b = int(std::find(bin.begin(), bin.end(), up.first) - bin.begin());
+      expect[b] += up.second;
+      expect_max[b] = std::max(expect_max[b], up.second);
+    }
+  }
+  auto ups = updates_of(me);
+
+  auto check = [&](vector<int64_t> const &want) {
+    upcxx::barrier();
+    vector<int64_t> got(BINS_PER_RANK);
+    ad.fetch_op_batch(atomic_op::load, my_bins.begin(), my_bins.end(), got.data(),
+                      memory_order_relaxed).wait();
+    for(int b=0; b < BINS_PER_RANK; b++)
+      UPCXX_ASSERT_ALWAYS(got[b] == want[me*BINS_PER_RANK + b],
+        "bin " << b << " has " << got[b] << ", expected " << want[me*BINS_PER_RANK + b]);
+    upcxx::barrier();
+  };
+
+  // plain batch
+  zero();
+  ad.op_batch(atomic_op::add, ups.begin(), ups.end(), memory_order_relaxed).wait();
+  check(expect);
+
+  // combined batch, through a promise
+  zero();
+  {
+    upcxx::promise<> p;
+    ad.op_batch_combined(atomic_op::add, ups.begin(), ups.end(), memory_order_relaxed,
+                         upcxx::operation_cx::as_promise(p));
+    p.finalize().wait();
+  }
+  check(expect);
+
+  zero();
+  ad.op_batch_combined(atomic_op::max, ups.begin(), ups.end(), memory_order_relaxed).wait();
+  check(expect_max);
+
+  // fetching batch: with only this rank adding, every fetched value is a
+  // partial sum, and the fetched values plus operands account for the total
+  zero();
+  if(me == 0) {
+    vector<int64_t> got(ups.size(), -1);
+    ad.fetch_op_batch(atomic_op::fetch_add, ups.begin(), ups.end(), got.data(),
+                      memory_order_relaxed).wait();
+    for(size_t i=0; i < ups.size(); i++)
+      UPCXX_ASSERT_ALWAYS(got[i] >= 0);
+
+    vector<int64_t> loaded(bins, -1);
+    vector<pair<global_ptr<int64_t>, int64_t>> loads;
+    for(int b=0; b < bins; b++)
+      loads.push_back({bin[b], 0});
+    ad.fetch_op_batch(atomic_op::load, loads.begin(), loads.end(), loaded.data(),
+                      memory_order_relaxed).wait();
+
+    // the largest fetched value per bin plus its operand is the final count
+    vector<int64_t> last(bins, 0);
+    for(size_t i=0; i < ups.size(); i++) {
+      int b = int(std::find(bin.begin(), bin.end(), ups[i].first) - bin.begin());
+      last[b] = std::max(last[b], got[i] + ups[i].second);
+    }
+    for(int b=0; b < bins; b++)
+      UPCXX_ASSERT_ALWAYS(loaded[b] == last[b]);
+  }
+  upcxx::barrier();
+
+  // an empty batch completes immediately
+  vector<pair<global_ptr<int64_t>, int64_t>> none;
+  ad.op_batch(atomic_op::add, none.begin(), none.end(), memory_order_relaxed).wait();
+
+  upcxx::barrier();
+  upcxx::delete_array(*mine);
+  ad.destroy();
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
@@ -0,0 +1,91 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// atomic_domain_mode::native_local: a domain over local_team() always takes
+// the CPU path, and one over world() must agree with the network path for
+// whatever mix of on-node and off-node targets it sees.
+
+using namespace std;
+using upcxx::atomic_domain;
+using upcxx::atomic_domain_mode;
+using upcxx::atomic_op;
+using upcxx::global_ptr;
+
+constexpr int ITERS = 100;
+
+template<typename T>
+void hammer(upcxx::team &tm, atomic_domain<T> &ad, global_ptr<T> ctr) {
+  // every member hits its team's rank 0 with a mix of singles and batches
+  for(int i=0; i < ITERS; i++) {
+    switch(i % 4) {
+    case 0: {
+        T prev = ad.fetch_add(ctr, T(2), memory_order_relaxed).wait();
+        UPCXX_ASSERT_ALWAYS(prev >= T(0) && prev < T(4*ITERS*tm.rank_n()));
+      } break;
+    case 1:
+      ad.inc(ctr, memory_order_relaxed).wait();
+      break;
+    case 2: {
+        vector<pair<global_ptr<T>, T>> ups(3, {ctr, T(1)});
+        ad.op_batch_combined(atomic_op::add, ups.begin(), ups.end(), memory_order_relaxed).wait();
+      } break;
+    case 3: {
+        // compare_exchange loop implementing add(1)
+        T cur = ad.load(ctr, memory_order_acquire).wait();
+        while(true) {
+          T prev = ad.compare_exchange(ctr, cur, cur + T(1), memory_order_acq_rel).wait();
+          if(prev == cur) break;
+          cur = prev;
+        }
+      } break;
+    }
+  }
+
+  upcxx::barrier(tm);
+  T total = ad.load(ctr, memory_order_relaxed).wait();
+  UPCXX_ASSERT_ALWAYS(total == T((2+1+3+1)*(ITERS/4)*tm.rank_n()),
+    "total=" << total);
+  upcxx::barrier(tm);
+}
+
+template<typename T>
+void run(upcxx::team &tm) {
+  atomic_domain<T> ad({atomic_op::load, atomic_op::store, atomic_op::compare_exchange,
+                       atomic_op::add, atomic_op::fetch_add, atomic_op::inc},
+                      tm, atomic_domain_mode::native_local);
+
+  if(&tm == &upcxx::local_team())
+    UPCXX_ASSERT_ALWAYS(ad.is_native_local());
+
+  upcxx::dist_object<global_ptr<T>> dobj(upcxx::new_<T>(0), tm);
+  global_ptr<T> ctr = dobj.fetch(0).wait();
+
+  hammer(tm, ad, ctr);
+
+  upcxx::barrier(tm);
+  upcxx::delete_(*dobj);
+  ad.destroy();
+}
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  run<int64_t>(upcxx::local_team());
+  run<uint32_t>(upcxx::world());
+  run<double>(upcxx::world());
+
+  // the default mode never bypasses
+  atomic_domain<int32_t> plain({atomic_op::load});
+  UPCXX_ASSERT_ALWAYS(!plain.is_native_local());
+  plain.destroy();
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
@@ -3,8 +3,13 @@
 
 #include "util.hpp"
 
+#include <algorithm>
+#include <complex>
+#include <list>
 #include <set>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 using namespace std;
 
@@ -71,6 +76,41 @@ upcxx::future<> test_team(const upcxx::team &tm) {
       );
   }
   
+  // a payload spanning many broadcast segments, and an empty one
+  {
+    int root = n/2;
+    std::vector<std::string> big;
+    if(me == root) {
+      for(int j=0; j < 4000; j++)
+        big.push_back(std::string(500 + j%37, char('a' + j%26)));
+    }
+    all_done = upcxx::when_all(all_done,
+      upcxx::broadcast_nontrivial(big, root, tm)
+        .then([](std::vector<std::string> const &got) {
+          UPCXX_ASSERT_ALWAYS(got.size() == 4000);
+          for(int j=0; j < 4000; j++)
+            UPCXX_ASSERT_ALWAYS(got[j] == std::string(500 + j%37, char('a' + j%26)));
+        })
+      );
+    // not a sequence, so sent as segments of one serialized image
+    std::pair<int, std::vector<std::string>> big_pair;
+    if(me == root)
+      big_pair = {7, big};
+    all_done = upcxx::when_all(all_done,
+      upcxx::broadcast_nontrivial(big_pair, root, tm)
+        .then([](std::pair<int, std::vector<std::string>> const &got) {
+          UPCXX_ASSERT_ALWAYS(got.first == 7 && got.second.size() == 4000);
+          UPCXX_ASSERT_ALWAYS(got.second[3999] == std::string(500 + 3999%37, char('a' + 3999%26)));
+        })
+      );
+    all_done = upcxx::when_all(all_done,
+      upcxx::broadcast_nontrivial(std::list<int>(), root, tm)
+        .then([](std::list<int> const &got) {
+          UPCXX_ASSERT_ALWAYS(got.empty());
+        })
+      );
+  }
+  
   // reduce_all(+) sum1 twice as 16 bit and 32 bit and validate they match
   auto sum1_done = upcxx::reduce_all(sum1, upcxx::op_fast_add, tm);
   auto sum2_done = upcxx::reduce_all(uint16_t(sum1), [](uint16_t a, uint16_t b) { return a+b; }, tm);
@@ -188,6 +228,79 @@ upcxx::future<> test_team(const upcxx::team &tm) {
       );
   }
   
+  { // vector reduces over types GEX lacks: complex (lane-wise), and short
+    // and a small struct (software kernels)
+    const int n = 10000;
+    struct pair16 { int16_t lo, hi; };
+    std::complex<double> *csrc = new std::complex<double>[n];
+    std::complex<double> *cdst = new std::complex<double>[n];
+    int16_t *ssrc = new int16_t[n];
+    int16_t *sdst = new int16_t[n];
+    pair16 *psrc = new pair16[n];
+    pair16 *pdst = new pair16[n];
+    for(int i=0; i < n; i++) {
+      csrc[i] = std::complex<double>(i, tm.rank_me());
+      ssrc[i] = int16_t(i % 100);
+      psrc[i] = pair16{int16_t(tm.rank_me()), int16_t(tm.rank_me() + i%7)};
+    }
+    
+    auto c_done = upcxx::reduce_all(csrc, cdst, n, upcxx::op_fast_add, tm);
+    auto s_done = upcxx::reduce_all(ssrc, sdst, n, upcxx::op_fast_max, tm);
+    auto p_done = upcxx::reduce_all(psrc, pdst, n,
+      [](pair16 a, pair16 b) {
+        return pair16{std::min(a.lo, b.lo), std::max(a.hi, b.hi)};
+      }, tm);
+    
+    all_done = upcxx::when_all(all_done,
+        upcxx::when_all(c_done, s_done, p_done)
+        .then([=,&tm]() {
+          double rn = tm.rank_n();
+          for(int i=0; i < n; i++) {
+            UPCXX_ASSERT_ALWAYS(cdst[i] == std::complex<double>(i*rn, (rn*rn - rn)/2));
+            UPCXX_ASSERT_ALWAYS(sdst[i] == int16_t(i % 100));
+            UPCXX_ASSERT_ALWAYS(pdst[i].lo == 0 && pdst[i].hi == tm.rank_n()-1 + i%7);
+          }
+          delete[] csrc; delete[] cdst;
+          delete[] ssrc; delete[] sdst;
+          delete[] psrc; delete[] pdst;
+        })
+      );
+  }
+  
+  // reduce_scatter and reduce_all_inplace, small enough for the GEX path and
+  // large enough for the ring (in-place length not a multiple of rank_n)
+  for(int n: {37, 20011}) {
+    int rn = tm.rank_n(), me = tm.rank_me();
+    int m = n*rn + 3;
+    double *src = new double[n*rn];
+    double *dst = new double[n];
+    double *buf = new double[m];
+    for(int i=0; i < n*rn; i++)
+      src[i] = i + me;
+    for(int i=0; i < n; i++)
+      dst[i] = 666;
+    for(int i=0; i < m; i++)
+      buf[i] = i*(me+1);
+    
+    auto rs_done = upcxx::reduce_scatter(src, dst, n, upcxx::op_fast_add, tm);
+    auto ip_done = upcxx::reduce_all_inplace(buf, m, std::plus<double>(), tm);
+    
+    all_done = upcxx::when_all(all_done,
+        upcxx::when_all(rs_done, ip_done)
+        .then([=]() {
+          for(int i=0; i < n; i++) {
+            double k = double(n)*me + i;
+            UPCXX_ASSERT_ALWAYS(dst[i] == k*rn + (double(rn)*rn - rn)/2);
+          }
+          for(int i=0; i < m; i++)
+            UPCXX_ASSERT_ALWAYS(buf[i] == i*(double(rn)*(rn+1)/2));
+          delete[] src;
+          delete[] dst;
+          delete[] buf;
+        })
+      );
+  }
+  
   return all_done;
 }
 
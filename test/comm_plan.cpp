@@ -0,0 +1,117 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+// A 1-D halo exchange recorded once in a comm_plan and relaunched each step:
+// contiguous, strided and irregular puts to both neighbors, a get, and a
+// notification rpc per neighbor which must only arrive after the data.
+
+using namespace std;
+using upcxx::global_ptr;
+using upcxx::intrank_t;
+
+constexpr int W = 64; // interior width
+constexpr int G = 2;  // ghost width
+constexpr int ROWS = 3;
+constexpr int STRIDE = W + 2*G; // a row: [ghost_lo | interior | ghost_hi]
+
+int notes = 0;
+
+int64_t value(intrank_t r, int step, int row, int col) {
+  return 1000000*r + 10000*step + 100*row + col;
+}
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+  intrank_t left = (me + n - 1) % n;
+  intrank_t right = (me + 1) % n;
+
+  // ROWS rows of STRIDE elements, followed by a scratch region
+  constexpr int grid_n = ROWS*STRIDE;
+  constexpr int scratch_n = 2*ROWS*G;
+  upcxx::dist_object<global_ptr<int64_t>> mine(upcxx::new_array<int64_t>(grid_n + scratch_n));
+  global_ptr<int64_t> lp = mine.fetch(left).wait();
+  global_ptr<int64_t> rp = mine.fetch(right).wait();
+  int64_t *grid = mine->local();
+  int64_t *scratch = grid + grid_n;
+
+  vector<int64_t> fetched(ROWS*W);
+
+  upcxx::comm_plan plan;
+  {
+    // my first G interior columns fill my left neighbor's high ghosts
+    using plan2 = upcxx::strided_plan<int64_t,2>;
+    plan.rput(plan2::dense_slices({{STRIDE, ROWS}}, {{G, 0}},
+                                  {{STRIDE, ROWS}}, {{G + W, 0}},
+                                  {{G, ROWS}}),
+              grid, lp);
+
+    // my last G interior columns fill my right neighbor's low ghosts, as
+    // an irregular put of one run per row
+    vector<pair<int64_t const*, size_t>> src;
+    vector<pair<global_ptr<int64_t>, size_t>> dst;
+    for(int row=0; row < ROWS; row++) {
+      src.push_back({grid + row*STRIDE + W, G});
+      dst.push_back({rp + row*STRIDE, G});
+    }
+    plan.rput_irregular(src.begin(), src.end(), dst.begin(), dst.end());
+
+    // my whole first row, contiguous, into the right neighbor's scratch
+    plan.rput(grid + G, rp + grid_n, size_t(G));
+
+    // fetch the left neighbor's interior
+    for(int row=0; row < ROWS; row++)
+      plan.rget(global_ptr<const int64_t>(lp + row*STRIDE + G), fetched.data() + row*W, size_t(W));
+
+    plan.notify(left, []() { notes += 1; });
+    plan.notify(right, []() { notes += 1; });
+  }
+  UPCXX_ASSERT_ALWAYS(plan.size() == 3 + ROWS);
+
+  for(int step=0; step < 5; step++) {
+    for(int row=0; row < ROWS; row++)
+      for(int col=0; col < STRIDE; col++)
+        grid[row*STRIDE + col] = col >= G && col < G + W ? value(me, step, row, col) : -1;
+    std::fill(scratch, scratch + scratch_n, -1);
+
+    upcxx::barrier(); // everyone's interior is written
+
+    plan.launch().wait();
+
+    // both neighbors' notifications have arrived, so their data has too
+    while(notes < 2*(step+1))
+      upcxx::progress();
+
+    for(int row=0; row < ROWS; row++) {
+      for(int g=0; g < G; g++) {
+        UPCXX_ASSERT_ALWAYS(grid[row*STRIDE + g] == value(left, step, row, W + g));
+        UPCXX_ASSERT_ALWAYS(grid[row*STRIDE + G + W + g] == value(right, step, row, G + g));
+      }
+      for(int col=0; col < W; col++)
+        UPCXX_ASSERT_ALWAYS(fetched[row*W + col] == value(left, step, row, G + col));
+    }
+    for(int g=0; g < G; g++)
+      UPCXX_ASSERT_ALWAYS(scratch[g] == value(left, step, 0, G + g));
+
+    upcxx::barrier(); // everyone is done reading before the next step
+  }
+
+  // an empty plan completes immediately
+  upcxx::comm_plan empty;
+  empty.launch().wait();
+
+  upcxx::barrier();
+  upcxx::delete_array(*mine);
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
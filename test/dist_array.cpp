@@ -0,0 +1,76 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// dist_array in block and block-cyclic layouts: owners fill their portion
+// by global index, every rank reads ranges spanning several owners, and
+// each rank writes a disjoint slice which the owners then check locally.
+
+using namespace std;
+using upcxx::dist_array;
+
+void run(dist_array<std::int64_t> &arr) {
+  int me = upcxx::rank_me();
+  int n = upcxx::rank_n();
+  std::size_t len = arr.size();
+
+  std::size_t local_n = upcxx::reduce_all(arr.local_size(), upcxx::op_fast_add).wait();
+  UPCXX_ASSERT_ALWAYS(local_n == len);
+
+  arr.for_each_local([&](std::size_t i, std::int64_t &x) {
+    UPCXX_ASSERT_ALWAYS(arr.owner(i) == me);
+    UPCXX_ASSERT_ALWAYS(arr.pointer_to(i).local() == &x);
+    x = std::int64_t(i);
+  });
+  upcxx::barrier();
+
+  // whole array, then a range starting and ending mid-block
+  vector<std::int64_t> got(len, -1);
+  arr.get(0, len, got.data()).wait();
+  for(std::size_t i=0; i < len; i++)
+    UPCXX_ASSERT_ALWAYS(got[i] == std::int64_t(i), "got[" << i << "]=" << got[i]);
+
+  std::size_t lo = len/3 + 1, hi = len - 2;
+  vector<std::int64_t> part(hi - lo, -1);
+  arr.get(lo, hi, part.data()).wait();
+  for(std::size_t i=lo; i < hi; i++)
+    UPCXX_ASSERT_ALWAYS(part[i-lo] == std::int64_t(i));
+
+  upcxx::barrier();
+
+  // each rank negates its own slice of the index space
+  std::size_t slice_lo = len*me/n, slice_hi = len*(me+1)/n;
+  vector<std::int64_t> neg;
+  for(std::size_t i=slice_lo; i < slice_hi; i++)
+    neg.push_back(-std::int64_t(i));
+  arr.put(neg.data(), slice_lo, slice_hi).wait();
+
+  upcxx::barrier();
+  arr.for_each_local([&](std::size_t i, std::int64_t &x) {
+    UPCXX_ASSERT_ALWAYS(x == -std::int64_t(i), "element " << i << " is " << x);
+  });
+  upcxx::barrier();
+}
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  {
+    dist_array<std::int64_t> block(1000);
+    run(block);
+    block.destroy();
+  }
+  {
+    dist_array<std::int64_t> cyclic(1001, 3);
+    run(cyclic);
+    cyclic.destroy();
+  }
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
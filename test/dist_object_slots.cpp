@@ -0,0 +1,82 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <memory>
+#include <vector>
+
+// More live dist_objects than the registry has slots, so some ids share a
+// slot and resolve through the map. Objects are created, moved, destroyed,
+// and replaced while RPCs keep targeting them by reference.
+
+using namespace std;
+using upcxx::dist_object;
+using upcxx::intrank_t;
+
+constexpr int OBJS = 3*int(upcxx::detail::dist_slot_n);
+
+// sum the neighbor's values for every object in `objs`
+long check(vector<unique_ptr<dist_object<long>>> &objs, intrank_t nebr) {
+  upcxx::promise<> all;
+  long sum = 0;
+  for(auto &o: objs) {
+    all.require_anonymous(1);
+    upcxx::rpc(nebr,
+      [](dist_object<long> &his) {
+        UPCXX_ASSERT_ALWAYS(&his.id().here() == &his);
+        UPCXX_ASSERT_ALWAYS(his.id().when_here().ready());
+        return *his;
+      }, *o
+    ).then([&](long x) {
+      sum += x;
+      all.fulfill_anonymous(1);
+    });
+  }
+  all.finalize().wait();
+  return sum;
+}
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+  intrank_t nebr = (me + 1) % n;
+
+  auto value = [](intrank_t r, int i) { return long(r)*OBJS + i; };
+
+  long expect = 0;
+  for(int i=0; i < OBJS; i++)
+    expect += value(nebr, i);
+
+  {
+    vector<unique_ptr<dist_object<long>>> objs;
+    for(int i=0; i < OBJS; i++)
+      objs.emplace_back(new dist_object<long>(value(me, i)));
+
+    UPCXX_ASSERT_ALWAYS(check(objs, nebr) == expect);
+    upcxx::barrier();
+
+    // free every other object's slot and refill it with a moved-to object
+    for(int i=0; i < OBJS; i += 2) {
+      dist_object<long> tmp(value(me, i));
+      objs[i].reset(new dist_object<long>(std::move(tmp)));
+    }
+
+    UPCXX_ASSERT_ALWAYS(check(objs, nebr) == expect);
+    upcxx::barrier();
+
+    // replace the first slot-sized run without a barrier, so RPCs may
+    // arrive before their target exists and must wait for it
+    for(int i=0; i < int(upcxx::detail::dist_slot_n); i++)
+      objs[i].reset(new dist_object<long>(value(me, i)));
+
+    UPCXX_ASSERT_ALWAYS(check(objs, nebr) == expect);
+    upcxx::barrier();
+  }
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
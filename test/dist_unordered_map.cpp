@@ -0,0 +1,82 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <cstdint>
+#include <string>
+
+// dist_unordered_map: every rank counts the same stream of integer keys
+// with update(), then string keys are inserted and looked up in batches
+// small enough to force several sends per destination.
+
+using namespace std;
+using upcxx::dist_unordered_map;
+
+constexpr int KEYS = 1000;
+constexpr int REPEAT = 3;
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  int me = upcxx::rank_me();
+  int n = upcxx::rank_n();
+
+  {
+    dist_unordered_map<std::uint64_t, std::uint64_t> counts(7);
+
+    for(int rep=0; rep < REPEAT; rep++) {
+      for(int k=0; k < KEYS; k++)
+        counts.update(std::uint64_t(k)*k, 1);
+    }
+    counts.flush().wait();
+    upcxx::barrier();
+
+    std::uint64_t local_total = 0;
+    counts.for_each_local([&](std::uint64_t key, std::uint64_t c) {
+      UPCXX_ASSERT_ALWAYS(counts.owner(key) == me);
+      UPCXX_ASSERT_ALWAYS(c == std::uint64_t(REPEAT*n), "key " << key << " counted " << c);
+      local_total += c;
+    });
+    std::uint64_t total = upcxx::reduce_all(local_total, upcxx::op_fast_add).wait();
+    UPCXX_ASSERT_ALWAYS(total == std::uint64_t(KEYS*REPEAT*n));
+    std::uint64_t size = upcxx::reduce_all(counts.local_size(), upcxx::op_fast_add).wait();
+    UPCXX_ASSERT_ALWAYS(size == std::uint64_t(KEYS));
+
+    upcxx::barrier();
+  }
+
+  {
+    dist_unordered_map<std::string, std::string> names(16);
+
+    // each key is inserted by one rank
+    for(int k=0; k < KEYS; k++) {
+      if(k % n == me)
+        names.insert("key" + to_string(k), "val" + to_string(k));
+    }
+    names.flush().wait();
+    upcxx::barrier();
+
+    int hits = 0;
+    for(int k=0; k < KEYS + 10; k++) {
+      names.find("key" + to_string(k)).then(
+        [&hits,k](bool found, std::string const &val) {
+          if(k < KEYS) {
+            UPCXX_ASSERT_ALWAYS(found && val == "val" + to_string(k), "key" << k);
+            hits += 1;
+          }
+          else
+            UPCXX_ASSERT_ALWAYS(!found && val.empty());
+        }
+      );
+    }
+    names.flush().wait();
+    UPCXX_ASSERT_ALWAYS(hits == KEYS);
+
+    upcxx::barrier();
+  }
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <vector>
+
+// Halo-style exchange with NBI regions: every rank fills a slice of each
+// neighbor's array with many small puts, fences with a single nbi_end(), then
+// reads them back with gets inside another region.
+
+using namespace std;
+using upcxx::global_ptr;
+using upcxx::intrank_t;
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+  intrank_t right = (me + 1) % n;
+  intrank_t left = (me + n - 1) % n;
+
+  constexpr int len = 4096;
+
+  upcxx::dist_object<global_ptr<int>> mine(upcxx::new_array<int>(2*len));
+  global_ptr<int> to_right = mine.fetch(right).wait();
+  global_ptr<int> to_left = mine.fetch(left).wait();
+
+  vector<int> src(len);
+
+  for(int step=0; step < 10; step++) {
+    for(int i=0; i < len; i++)
+      src[i] = 1000000*step + 10*me + i;
+
+    UPCXX_ASSERT_ALWAYS(!upcxx::nbi_in_region());
+    upcxx::nbi_begin();
+    UPCXX_ASSERT_ALWAYS(upcxx::nbi_in_region());
+    // left half of right's array gets our array elementwise, right half of
+    // left's array gets it in one put
+    for(int i=0; i < len; i++)
+      upcxx::rput_nbi(src[i], to_right + i);
+    upcxx::rput_nbi(src.data(), to_left + len, len);
+    upcxx::future<> f = upcxx::nbi_end();
+    UPCXX_ASSERT_ALWAYS(!upcxx::nbi_in_region());
+    f.wait();
+
+    upcxx::barrier();
+
+    int *local = mine->local();
+    for(int i=0; i < len; i++) {
+      UPCXX_ASSERT_ALWAYS(local[i] == 1000000*step + 10*left + i);
+      UPCXX_ASSERT_ALWAYS(local[len + i] == 1000000*step + 10*right + i);
+    }
+
+    // read them back from the neighbors, with promise completion this time
+    vector<int> back(2*len, -1);
+    upcxx::promise<> pro;
+    upcxx::nbi_begin();
+    upcxx::rget_nbi(to_right, back.data(), len);
+    for(int i=0; i < len; i++)
+      upcxx::rget_nbi(to_left + len + i, &back[len + i], 1);
+    upcxx::nbi_end(upcxx::operation_cx::as_promise(pro));
+    pro.finalize().wait();
+
+    for(int i=0; i < 2*len; i++)
+      UPCXX_ASSERT_ALWAYS(back[i] == src[i % len]);
+
+    upcxx::barrier();
+  }
+
+  // an empty region still completes
+  upcxx::nbi_begin();
+  upcxx::nbi_end().wait();
+
+  upcxx::barrier();
+  upcxx::delete_array(*mine);
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
@@ -0,0 +1,72 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Back-to-back world barriers, broadcasts and reductions with every rank
+// taking a turn as root. Payloads straddle UPCXX_NODE_COLL_SLOT so both the
+// node-aware and flat GEX paths run interleaved.
+
+using namespace std;
+using upcxx::intrank_t;
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+
+  for(int round=0; round < 3; round++) {
+    for(int count: {1, 17, 255, 256, 257, 4000}) {
+      for(intrank_t root=0; root < n; root++) {
+        vector<int64_t> buf(count, me == root ? root*1000 + count : -1);
+        upcxx::broadcast(buf.data(), count, root).wait();
+        for(int64_t x: buf)
+          UPCXX_ASSERT_ALWAYS(x == root*1000 + count, "broadcast got "<<x);
+
+        vector<int64_t> src(count), dst(count, -1);
+        for(int i=0; i < count; i++)
+          src[i] = me + i;
+
+        upcxx::reduce_one(src.data(), dst.data(), count, upcxx::op_fast_add, root).wait();
+        if(me == root) {
+          for(int i=0; i < count; i++)
+            UPCXX_ASSERT_ALWAYS(dst[i] == int64_t(n)*i + int64_t(n)*(n-1)/2);
+        }
+
+        upcxx::reduce_all(src.data(), dst.data(), count, upcxx::op_fast_max).wait();
+        for(int i=0; i < count; i++)
+          UPCXX_ASSERT_ALWAYS(dst[i] == n-1 + i);
+
+        // user op, combined in software by node leaders
+        upcxx::reduce_all(src.data(), dst.data(), count,
+          [](int64_t a, int64_t b) { return a < b ? a : b; }).wait();
+        for(int i=0; i < count; i++)
+          UPCXX_ASSERT_ALWAYS(dst[i] == i);
+      }
+
+      // several in flight at once
+      upcxx::future<> f = upcxx::make_future();
+      double sums[8];
+      for(int k=0; k < 8; k++) {
+        f = upcxx::when_all(f, upcxx::barrier_async());
+        f = upcxx::when_all(f,
+          upcxx::reduce_all(double(me + k), upcxx::op_fast_add)
+            .then([&sums, k](double s) { sums[k] = s; })
+        );
+      }
+      f.wait();
+      for(int k=0; k < 8; k++)
+        UPCXX_ASSERT_ALWAYS(sums[k] == double(n)*(n-1)/2 + double(n)*k);
+
+      upcxx::barrier();
+    }
+  }
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
@@ -0,0 +1,85 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <vector>
+
+// Producer/consumer through notify_counter: every rank puts batches into its
+// right neighbor, each put bumping the neighbor's counter on completion, and
+// the consumer waits on its own counter before reading. Also checks weighted
+// increments and combination with other completions.
+
+using namespace std;
+using upcxx::global_ptr;
+using upcxx::intrank_t;
+using upcxx::operation_cx;
+using upcxx::remote_cx;
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+  intrank_t nebr = (me + 1) % n;
+  intrank_t from = (me + n - 1) % n;
+
+  constexpr int batches = 10;
+  constexpr size_t batch_len = 1000;
+
+  upcxx::notify_counter ctr;
+  // before anyone can learn where it is
+  UPCXX_ASSERT_ALWAYS(ctr.load() == 0);
+
+  upcxx::dist_object<global_ptr<uint64_t>> ctr_where(ctr.where());
+  upcxx::dist_object<global_ptr<int>> buf(upcxx::new_array<int>(batches*batch_len));
+  global_ptr<uint64_t> their_ctr = ctr_where.fetch(nebr).wait();
+  global_ptr<int> their_buf = buf.fetch(nebr).wait();
+
+  vector<int> src(batches*batch_len);
+  for(size_t i=0; i < src.size(); i++)
+    src[i] = 1000000*me + int(i);
+
+  // counter alone: no local notification at all
+  for(int b=0; b < batches; b++)
+    upcxx::rput(src.data() + b*batch_len, their_buf + b*batch_len, batch_len,
+                remote_cx::as_counter(ctr, their_ctr));
+
+  int *mine = buf->local();
+  ctr.wait_until(batches);
+  for(size_t i=0; i < src.size(); i++)
+    UPCXX_ASSERT_ALWAYS(mine[i] == 1000000*from + int(i));
+
+  upcxx::barrier();
+  ctr.reset();
+  upcxx::barrier();
+
+  // weighted by element count, and combined with operation completion
+  upcxx::future<> all = upcxx::make_future();
+  for(int b=0; b < batches; b++)
+    all = upcxx::when_all(all,
+      upcxx::rput(src.data() + b*batch_len, their_buf + b*batch_len, batch_len,
+                  remote_cx::as_counter(ctr, their_ctr, batch_len) |
+                  operation_cx::as_future()));
+  all.wait();
+
+  ctr.wait_until(batches*batch_len);
+  UPCXX_ASSERT_ALWAYS(ctr.load() == batches*batch_len);
+
+  // scalar puts count too
+  upcxx::barrier();
+  ctr.reset();
+  upcxx::barrier();
+  upcxx::rput(-me, their_buf, remote_cx::as_counter(ctr, their_ctr));
+  ctr.wait_until(1);
+  UPCXX_ASSERT_ALWAYS(mine[0] == -from);
+
+  upcxx::discharge(); // retire our own increments before the domain goes away
+  upcxx::barrier();
+  upcxx::delete_array(*buf);
+  ctr.destroy();
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
@@ -0,0 +1,102 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Chunked transfers to a neighbor: an rput_chunked from a user buffer, an
+// rput_stream whose chunks are generated on demand, and an rget_chunked back,
+// over sizes that do and do not divide evenly into chunks.
+
+using namespace std;
+using upcxx::global_ptr;
+using upcxx::intrank_t;
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+  intrank_t nebr = (me + 1) % n;
+  intrank_t from = (me + n - 1) % n;
+
+  constexpr size_t len = 100000;
+
+  upcxx::dist_object<global_ptr<int64_t>> mine(upcxx::new_array<int64_t>(len));
+  global_ptr<int64_t> theirs = mine.fetch(nebr).wait();
+
+  vector<int64_t> src(len), back(len);
+
+  for(size_t count: {0, 1, 999, 4096, 100000}) {
+    for(size_t chunk_bytes: {8, 1000, 32768}) {
+      upcxx::rma_chunking opts;
+      opts.chunk_bytes = chunk_bytes;
+      opts.window = 3;
+
+      int64_t seed = 1000000*me + count + chunk_bytes;
+      for(size_t i=0; i < count; i++)
+        src[i] = seed + i;
+
+      // put from a buffer, counting source completions
+      size_t src_done = 0;
+      upcxx::rput_chunked(src.data(), theirs, count,
+        [&](size_t off, size_t cnt) {
+          UPCXX_ASSERT_ALWAYS(off + cnt <= count);
+          src_done += cnt;
+        },
+        opts
+      ).wait();
+      UPCXX_ASSERT_ALWAYS(src_done == count);
+
+      upcxx::barrier();
+      int64_t their_seed = 1000000*from + count + chunk_bytes;
+      int64_t *local = mine->local();
+      for(size_t i=0; i < count; i++)
+        UPCXX_ASSERT_ALWAYS(local[i] == their_seed + int64_t(i));
+      upcxx::barrier();
+
+      // put from a producer, negating the values
+      size_t filled = 0;
+      upcxx::rput_stream(theirs, count,
+        [&](int64_t *buf, size_t off, size_t cnt) {
+          UPCXX_ASSERT_ALWAYS(off == filled); // chunks are produced in order
+          for(size_t i=0; i < cnt; i++)
+            buf[i] = -(seed + int64_t(off + i));
+          filled += cnt;
+        },
+        opts
+      ).wait();
+      UPCXX_ASSERT_ALWAYS(filled == count);
+
+      upcxx::barrier();
+
+      // read our own negated values back from the neighbor
+      size_t got = 0;
+      upcxx::rget_chunked(global_ptr<const int64_t>(theirs), back.data(), count,
+        [&](size_t off, size_t cnt) {
+          for(size_t i=off; i < off + cnt; i++)
+            UPCXX_ASSERT_ALWAYS(back[i] == -(seed + int64_t(i)));
+          got += cnt;
+        },
+        opts
+      ).wait();
+      UPCXX_ASSERT_ALWAYS(got == count);
+
+      upcxx::barrier();
+    }
+  }
+
+  // runtime defaults
+  upcxx::rput_chunked(src.data(), theirs, len).wait();
+  upcxx::rget_chunked(global_ptr<const int64_t>(theirs), back.data(), len).wait();
+  UPCXX_ASSERT_ALWAYS(back == src);
+
+  upcxx::barrier();
+  upcxx::delete_array(*mine);
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
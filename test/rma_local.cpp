@@ -0,0 +1,104 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <vector>
+
+// Exercises the shared-memory bypass of rput, rget and copy against a peer in
+// local_team(): every completion flavor, scalar and bulk transfers, and sizes
+// large and misaligned enough to take the non-temporal copy path.
+
+using namespace std;
+using upcxx::global_ptr;
+using upcxx::intrank_t;
+using upcxx::operation_cx;
+using upcxx::source_cx;
+using upcxx::remote_cx;
+
+int got_rpc = 0;
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  const upcxx::team &local = upcxx::local_team();
+  intrank_t me = local.rank_me();
+  intrank_t n = local.rank_n();
+  intrank_t nebr = local[(me + 1) % n];
+
+  constexpr size_t len = (3<<20)/sizeof(int) + 5;
+
+  upcxx::dist_object<global_ptr<int>> mine(upcxx::new_array<int>(len));
+  global_ptr<int> theirs = mine.fetch(nebr).wait();
+  UPCXX_ASSERT_ALWAYS(theirs.is_local());
+
+  vector<int> src(len), dst(len);
+
+  for(int step=0; step < 4; step++) {
+    int seed = 1000*step + 10*upcxx::rank_me();
+    for(size_t i=0; i < len; i++)
+      src[i] = seed + int(i);
+
+    // scalar puts and gets with each completion kind
+    upcxx::rput(seed, theirs).wait();
+    UPCXX_ASSERT_ALWAYS(upcxx::rget(theirs).wait() == seed);
+
+    upcxx::promise<> pro;
+    upcxx::rput(seed + 1, theirs + 1, operation_cx::as_promise(pro));
+    pro.finalize().wait();
+
+    upcxx::promise<int> pro_v;
+    upcxx::rget(theirs + 1, operation_cx::as_promise(pro_v));
+    UPCXX_ASSERT_ALWAYS(pro_v.finalize().wait() == seed + 1);
+
+    bool done = false;
+    upcxx::rput(seed + 2, theirs + 2,
+                operation_cx::as_lpc(upcxx::current_persona(), [&]() { done = true; }));
+    while(!done) upcxx::progress();
+
+    upcxx::rput(seed + 3, theirs + 3, operation_cx::as_blocking());
+    UPCXX_ASSERT_ALWAYS(upcxx::rget(theirs + 3).wait() == seed + 3);
+
+    // remote completion still runs on the peer
+    upcxx::rput(seed + 4, theirs + 4,
+                remote_cx::as_rpc([]() { got_rpc++; }) | operation_cx::as_future()).wait();
+
+    // bulk at misaligned offsets, with source completion
+    for(size_t off: {0, 1, 3}) {
+      size_t m = len - off;
+      done = false;
+      upcxx::rput(src.data() + off, theirs + off, m,
+                  source_cx::as_lpc(upcxx::current_persona(), [&]() { done = true; }) |
+                  operation_cx::as_future()).wait();
+      UPCXX_ASSERT_ALWAYS(done);
+
+      std::fill(dst.begin(), dst.end(), -1);
+      upcxx::rget(theirs + off, dst.data() + off, m).wait();
+      for(size_t i=off; i < len; i++)
+        UPCXX_ASSERT_ALWAYS(dst[i] == src[i]);
+
+      std::fill(dst.begin(), dst.end(), -1);
+      upcxx::copy(theirs + off, dst.data() + off, m).wait();
+      for(size_t i=off; i < len; i++)
+        UPCXX_ASSERT_ALWAYS(dst[i] == src[i]);
+    }
+
+    upcxx::copy(src.data(), theirs, len).wait();
+    upcxx::copy(theirs, *mine, len).wait();
+    int *local_mine = mine->local();
+    for(size_t i=0; i < len; i++)
+      UPCXX_ASSERT_ALWAYS(local_mine[i] == src[i]);
+
+    upcxx::barrier();
+  }
+
+  while(got_rpc != 4)
+    upcxx::progress();
+
+  upcxx::barrier();
+  upcxx::delete_array(*mine);
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
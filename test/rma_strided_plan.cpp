@@ -0,0 +1,132 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <array>
+#include <vector>
+
+// strided_plan against a neighbor: 3-D halo faces and an interior block
+// copied between dense arrays of different shapes, replayed over several
+// steps, and checked against the equivalent rget_strided.
+
+using namespace std;
+using upcxx::global_ptr;
+using upcxx::intrank_t;
+
+constexpr size_t NX = 13, NY = 7, NZ = 5;     // source array
+constexpr size_t MX = 17, MY = 9, MZ = 6;     // destination array
+constexpr size_t src_n = NX*NY*NZ, dst_n = MX*MY*MZ;
+
+int64_t value(intrank_t r, int step, size_t i) {
+  return 1000000*r + 10000*step + i;
+}
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+  intrank_t nebr = (me + 1) % n;
+  intrank_t from = (me + n - 1) % n;
+
+  upcxx::dist_object<global_ptr<int64_t>> mine(upcxx::new_array<int64_t>(dst_n));
+  global_ptr<int64_t> theirs = mine.fetch(nebr).wait();
+
+  using box = array<size_t,3>;
+  using plan_t = upcxx::strided_plan<int64_t,3>;
+
+  struct face { box src_lo, dst_lo, ext; };
+  face faces[] = {
+    {{{0,0,2}}, {{0,0,3}}, {{NX,NY,1}}}, // z-plane: contiguous x rows, one level
+    {{{0,0,0}}, {{0,0,0}}, {{NX,1,NZ}}}, // y-face: contiguous x rows, one level
+    {{{4,0,0}}, {{1,2,0}}, {{1,NY,NZ}}}, // x-face: every element strided
+    {{{2,3,1}}, {{5,1,2}}, {{3,2,2}}},   // interior block
+  };
+
+  vector<int64_t> src(src_n), back(src_n);
+
+  for(int step=0; step < 3; step++) {
+    for(size_t i=0; i < src_n; i++)
+      src[i] = value(me, step, i);
+
+    for(face &f: faces) {
+      plan_t plan = plan_t::dense_slices(box{{NX,NY,NZ}}, f.src_lo, box{{MX,MY,MZ}}, f.dst_lo, f.ext);
+      UPCXX_ASSERT_ALWAYS(plan.size() == f.ext[0]*f.ext[1]*f.ext[2]);
+      UPCXX_ASSERT_ALWAYS(plan.levels() <= 2); // x-extent always folds or drops
+
+      int64_t *local = mine->local();
+      std::fill(local, local + dst_n, -1);
+      upcxx::barrier();
+
+      plan.rput(src.data(), theirs).wait();
+      upcxx::barrier();
+
+      for(size_t z=0; z < MZ; z++)
+        for(size_t y=0; y < MY; y++)
+          for(size_t x=0; x < MX; x++) {
+            bool inside = x >= f.dst_lo[0] && x < f.dst_lo[0] + f.ext[0] &&
+                          y >= f.dst_lo[1] && y < f.dst_lo[1] + f.ext[1] &&
+                          z >= f.dst_lo[2] && z < f.dst_lo[2] + f.ext[2];
+            int64_t got = local[x + MX*(y + MY*z)];
+            if(inside) {
+              size_t sx = x - f.dst_lo[0] + f.src_lo[0];
+              size_t sy = y - f.dst_lo[1] + f.src_lo[1];
+              size_t sz = z - f.dst_lo[2] + f.src_lo[2];
+              UPCXX_ASSERT_ALWAYS(got == value(from, step, sx + NX*(sy + NY*sz)));
+            }
+            else
+              UPCXX_ASSERT_ALWAYS(got == -1);
+          }
+
+      upcxx::barrier();
+
+      // read our values back, the plan's source is now the remote array
+      plan_t back_plan = plan_t::dense_slices(box{{MX,MY,MZ}}, f.dst_lo, box{{NX,NY,NZ}}, f.src_lo, f.ext);
+      std::fill(back.begin(), back.end(), -2);
+      upcxx::promise<> pro;
+      back_plan.rget(global_ptr<const int64_t>(theirs), back.data(),
+                     upcxx::operation_cx::as_promise(pro));
+      pro.finalize().wait();
+
+      for(size_t z=0; z < NZ; z++)
+        for(size_t y=0; y < NY; y++)
+          for(size_t x=0; x < NX; x++) {
+            bool inside = x >= f.src_lo[0] && x < f.src_lo[0] + f.ext[0] &&
+                          y >= f.src_lo[1] && y < f.src_lo[1] + f.ext[1] &&
+                          z >= f.src_lo[2] && z < f.src_lo[2] + f.ext[2];
+            size_t i = x + NX*(y + NY*z);
+            UPCXX_ASSERT_ALWAYS(back[i] == (inside ? src[i] : -2));
+          }
+
+      // the unplanned call with the same uncoalesced shape agrees
+      array<ptrdiff_t,3> ss{{8, 8*NX, 8*NX*NY}}, ds{{8, 8*MX, 8*MX*MY}};
+      std::fill(back.begin(), back.end(), -2);
+      upcxx::rget_strided<3>(
+        global_ptr<const int64_t>(theirs + (f.dst_lo[0] + MX*(f.dst_lo[1] + MY*f.dst_lo[2]))), ds,
+        back.data() + (f.src_lo[0] + NX*(f.src_lo[1] + NY*f.src_lo[2])), ss,
+        f.ext
+      ).wait();
+      for(size_t z=0; z < f.ext[2]; z++)
+        for(size_t y=0; y < f.ext[1]; y++)
+          for(size_t x=0; x < f.ext[0]; x++) {
+            size_t i = (f.src_lo[0]+x) + NX*((f.src_lo[1]+y) + NY*(f.src_lo[2]+z));
+            UPCXX_ASSERT_ALWAYS(back[i] == src[i]);
+          }
+
+      upcxx::barrier();
+    }
+  }
+
+  // an empty slice completes without moving anything
+  plan_t empty = plan_t::dense_slices(box{{NX,NY,NZ}}, box{{0,0,0}}, box{{MX,MY,MZ}}, box{{0,0,0}}, box{{NX,0,NZ}});
+  UPCXX_ASSERT_ALWAYS(empty.size() == 0);
+  empty.rput(src.data(), theirs).wait();
+
+  upcxx::barrier();
+  upcxx::delete_array(*mine);
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
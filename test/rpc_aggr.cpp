@@ -0,0 +1,89 @@
+#include <upcxx/upcxx.hpp>
+
+#include <cstdint>
+#include <string>
+
+#include "util.hpp"
+
+// Floods every peer with small rpc_ff's of mixed sizes plus some rpc round
+// trips. Run with UPCXX_RPC_AGGR_SIZE set (eg 4096) to exercise the
+// aggregation path, which must deliver exactly the same messages.
+
+using upcxx::intrank_t;
+
+const int per_peer = 1000;
+
+std::int64_t arrived = 0;
+std::int64_t checksum = 0;
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+
+  upcxx::barrier();
+
+  std::int64_t sent_sum = 0;
+  upcxx::future<> replies = upcxx::make_future();
+
+  for(int i=0; i < per_peer; i++) {
+    for(intrank_t k=0; k < n; k++) {
+      intrank_t peer = (me + k) % n;
+      std::int64_t val = 1000*me + i;
+
+      if(i % 97 == 0) {
+        // payload larger than any batch, must bypass aggregation
+        std::string big(8192 + i, 'x');
+        upcxx::rpc_ff(peer, [](std::int64_t val, std::string const &s) {
+            UPCXX_ASSERT_ALWAYS(s.size() >= 8192 && s[s.size()-1] == 'x');
+            arrived += 1;
+            checksum += val;
+          }, val, big);
+      }
+      else if(i % 3 == 0) {
+        // odd-sized payload to shake out padding bugs
+        std::string small(i % 61, char('a' + i % 26));
+        upcxx::rpc_ff(peer, [](std::int64_t val, std::string const &s, int i) {
+            UPCXX_ASSERT_ALWAYS(s == std::string(i % 61, char('a' + i % 26)));
+            arrived += 1;
+            checksum += val;
+          }, val, small, i);
+      }
+      else {
+        upcxx::rpc_ff(peer, [](std::int64_t val) {
+            arrived += 1;
+            checksum += val;
+          }, val);
+      }
+      sent_sum += val;
+
+      if(i % 50 == 0) {
+        replies = upcxx::when_all(replies,
+          upcxx::rpc(peer, [](int x) { return x + 1; }, i)
+            .then([=](int y) { UPCXX_ASSERT_ALWAYS(y == i + 1); })
+        );
+      }
+    }
+
+    if(i % 100 == 0)
+      upcxx::progress();
+  }
+
+  replies.wait();
+
+  std::int64_t expect_n = std::int64_t(per_peer)*n;
+  while(arrived != expect_n)
+    upcxx::progress();
+
+  upcxx::barrier();
+
+  std::int64_t sent_all = upcxx::reduce_all(sent_sum, upcxx::op_fast_add).wait();
+  std::int64_t got_all = upcxx::reduce_all(checksum, upcxx::op_fast_add).wait();
+  UPCXX_ASSERT_ALWAYS(sent_all == got_all, "checksum mismatch: sent " << sent_all << " got " << got_all);
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
@@ -0,0 +1,101 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+// Streams rpc's carrying vector and view arguments whose sizes straddle the
+// rendezvous cutover to a neighbor. Repeated sizes recycle sender staging and
+// receiver landing buffers, and vectors of trivial elements are deserialized
+// in bulk, so every payload is checked element by element.
+
+using namespace std;
+using upcxx::intrank_t;
+
+int got = 0;
+
+template<typename Bag>
+bool check_seq(Bag const &xs, int64_t seed) {
+  int64_t i = 0;
+  for(auto x: xs) {
+    if(x != seed + i) return false;
+    i++;
+  }
+  return true;
+}
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+  intrank_t nebr = (me + 1) % n;
+
+  int sent = 0;
+
+  for(int round=0; round < 4; round++) {
+    for(size_t count: {0, 1, 100, 1000, 20000, 100000, 300000}) {
+      int64_t seed = 1000*me + 10*round + count;
+
+      vector<int64_t> v(count);
+      for(size_t i=0; i < count; i++)
+        v[i] = seed + i;
+      deque<double> d(v.begin(), v.end());
+      vector<string> s = {to_string(seed), string(count % 1000, 'x')};
+
+      upcxx::rpc_ff(nebr,
+        [=](vector<int64_t> const &v, deque<double> const &d,
+            vector<string> const &s, upcxx::view<int64_t> w) {
+          UPCXX_ASSERT_ALWAYS(v.size() == count && check_seq(v, seed));
+          UPCXX_ASSERT_ALWAYS(d.size() == count && check_seq(d, seed));
+          UPCXX_ASSERT_ALWAYS(s.size() == 2 && s[0] == to_string(seed) && s[1].size() == count % 1000);
+          UPCXX_ASSERT_ALWAYS(w.size() == count && check_seq(w, seed));
+          got++;
+        },
+        v, d, s, upcxx::make_view(v)
+      );
+      sent++;
+
+      // round trip with a vector result
+      vector<int64_t> back = upcxx::rpc(nebr,
+        [](vector<int64_t> v) {
+          for(int64_t &x: v) x += 1;
+          return v;
+        },
+        v
+      ).wait();
+      UPCXX_ASSERT_ALWAYS(back.size() == count && check_seq(back, seed + 1));
+    }
+  }
+
+  // A burst of rdzv rpc's with none of them waited on, enough to exhaust the
+  // pool of staging buffers and force senders to stall or overflow.
+  for(int i=0; i < 400; i++) {
+    size_t count = 1000 + (i % 7)*9000;
+    vector<int64_t> v(count);
+    for(size_t j=0; j < count; j++)
+      v[j] = i + j;
+    upcxx::rpc_ff(nebr,
+      [=](upcxx::view<int64_t> w) {
+        UPCXX_ASSERT_ALWAYS(w.size() == count && check_seq(w, i));
+        got++;
+      },
+      upcxx::make_view(v)
+    );
+    sent++;
+  }
+
+  // everyone receives from exactly one neighbor
+  int expect = upcxx::reduce_all(sent, upcxx::op_fast_add).wait() / n;
+  while(got != expect)
+    upcxx::progress();
+
+  upcxx::barrier();
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
@@ -0,0 +1,78 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// task_pool: rank 0 seeds an unbalanced tree which every rank (and, in
+// PAR threadmode, helper threads) expands by stealing. The number of nodes
+// processed everywhere must match the tree's size.
+
+using namespace std;
+
+struct node {
+  std::uint64_t id;
+  int depth;
+};
+
+constexpr int DEPTH = 14;
+
+// Children of a node: the leftmost path is long and bushy, so the work
+// starts in one place and has to move.
+int kids_of(node nd) {
+  if(nd.depth == DEPTH)
+    return 0;
+  return nd.id % 5 == 0 ? 3 : nd.id % 3 == 0 ? 0 : 2;
+}
+
+std::uint64_t tree_size(node nd) {
+  std::uint64_t n = 1;
+  for(int k=0; k < kids_of(nd); k++)
+    n += tree_size(node{nd.id*5 + k, nd.depth + 1});
+  return n;
+}
+
+std::atomic<std::uint64_t> processed{0};
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  #if UPCXX_THREADMODE
+    int threads = 3;
+  #else
+    int threads = 1;
+  #endif
+
+  {
+    upcxx::task_pool<node> pool(
+      [](upcxx::task_pool<node> &pool, node &&nd) {
+        processed.fetch_add(1, std::memory_order_relaxed);
+        for(int k=0; k < kids_of(nd); k++)
+          pool.spawn(node{nd.id*5 + k, nd.depth + 1});
+      },
+      upcxx::world(), threads
+    );
+
+    if(upcxx::rank_me() == 0)
+      pool.spawn(node{0, 0});
+
+    vector<std::thread> helpers;
+    for(int t=1; t < threads; t++)
+      helpers.emplace_back([&]() { pool.run(); });
+    pool.run();
+    for(std::thread &t: helpers)
+      t.join();
+
+    std::uint64_t total = upcxx::reduce_all(processed.load(), upcxx::op_fast_add).wait();
+    std::uint64_t expect = tree_size(node{0, 0});
+    UPCXX_ASSERT_ALWAYS(total == expect, "processed " << total << " of " << expect << " nodes");
+  }
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}
@@ -0,0 +1,89 @@
+#include <upcxx/upcxx.hpp>
+
+#include "util.hpp"
+
+#include <vector>
+
+// Builds many row/column sub-teams with split_async() and create(), with
+// several constructions in flight at once, and checks each team's shape by
+// running collectives over it.
+
+using namespace std;
+using upcxx::intrank_t;
+using upcxx::team;
+
+void check_team(team &tm, intrank_t expect_n, intrank_t expect_me) {
+  UPCXX_ASSERT_ALWAYS(tm.rank_n() == expect_n, "rank_n="<<tm.rank_n()<<" expected "<<expect_n);
+  UPCXX_ASSERT_ALWAYS(tm.rank_me() == expect_me, "rank_me="<<tm.rank_me()<<" expected "<<expect_me);
+
+  intrank_t sum = upcxx::reduce_all(tm.rank_me(), upcxx::op_fast_add, tm).wait();
+  UPCXX_ASSERT_ALWAYS(sum == expect_n*(expect_n-1)/2);
+
+  intrank_t root = upcxx::broadcast(upcxx::rank_me(), 0, tm).wait();
+  UPCXX_ASSERT_ALWAYS(tm[0] == root);
+}
+
+int main() {
+  upcxx::init();
+  print_test_header();
+
+  intrank_t me = upcxx::rank_me();
+  intrank_t n = upcxx::rank_n();
+
+  // a roughly square process grid
+  intrank_t cols = 1;
+  while(cols*cols < n) cols++;
+  intrank_t row = me / cols, col = me % cols;
+  intrank_t row_n = std::min(cols, n - row*cols);
+  intrank_t col_n = (n - col + cols-1)/cols;
+
+  for(int phase=0; phase < 20; phase++) {
+    upcxx::future<team> f_row = upcxx::world().split_async(row, col);
+    upcxx::future<team> f_col = upcxx::world().split_async(col, row);
+
+    // every other rank sits out this one
+    upcxx::future<team> f_evens = upcxx::world().split_async(
+      me % 2 == 0 ? 0 : team::color_none, me
+    );
+
+    // the row team again, this time by explicit member list in reverse
+    vector<intrank_t> members;
+    for(intrank_t c = row_n-1; c >= 0; c--)
+      members.push_back(row*cols + c);
+    upcxx::future<team> f_rev = upcxx::world().create(members);
+
+    upcxx::future<team> f_none = upcxx::world().create(vector<intrank_t>());
+
+    team t_row = std::move(f_row).wait();
+    team t_col = std::move(f_col).wait();
+    team t_evens = std::move(f_evens).wait();
+    team t_rev = std::move(f_rev).wait();
+    team t_none = std::move(f_none).wait();
+
+    check_team(t_row, row_n, col);
+    check_team(t_col, col_n, row);
+    check_team(t_rev, row_n, row_n-1 - col);
+
+    if(me % 2 == 0)
+      check_team(t_evens, (n+1)/2, me/2);
+    else
+      UPCXX_ASSERT_ALWAYS(t_evens.rank_n() == 0);
+
+    UPCXX_ASSERT_ALWAYS(t_none.rank_n() == 0);
+
+    // nested: split a team which was itself built asynchronously
+    team t_sub = t_row.split_async(t_row.rank_me() % 2, 0).wait();
+    check_team(t_sub, (row_n - t_row.rank_me()%2 + 1)/2, t_row.rank_me()/2);
+
+    t_sub.destroy();
+    t_none.destroy();
+    t_rev.destroy();
+    t_evens.destroy();
+    t_col.destroy();
+    t_row.destroy();
+  }
+
+  print_test_success();
+  upcxx::finalize();
+  return 0;
+}